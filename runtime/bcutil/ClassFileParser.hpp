@@ -54,6 +54,12 @@ public:
 
 	void restoreOriginalMethodBytecodes();
 
+	/**
+	 * Use a class file which was parsed before the parser was created, rather than calling parseClassFile().
+	 * The caller retains ownership of the memory.
+	 */
+	void setParsedClassFile(J9CfrClassFile *j9CfrClassFile) { _j9CfrClassFile = j9CfrClassFile; }
+
 	J9CfrClassFile *getParsedClassFile() { return _j9CfrClassFile; }
 
 private:
@@ -167,6 +167,31 @@ j9bcutil_buildRomClassIntoBuffer(
 }
 
 
+/**
+ * Answer the class file in localBuffer which was parsed before the class table mutex was taken, if it was
+ * parsed from the same bytes with the same flags as this build would use. Building may modify the parsed
+ * class file, so it is only handed out once.
+ */
+static J9CfrClassFile *
+takePreparsedClassFile(J9LoadROMClassData *loadData, UDATA bctFlags, J9TranslationLocalBuffer *localBuffer)
+{
+	J9CfrClassFile *parsedClassFile = NULL;
+
+	if (NULL != localBuffer) {
+		J9PreparsedClassFile *preparsedClassFile = localBuffer->preparsedClassFile;
+		if ((NULL != preparsedClassFile)
+			&& (loadData->classData == preparsedClassFile->classData)
+			&& (loadData->classDataLength == preparsedClassFile->classDataLength)
+			&& (bctFlags == preparsedClassFile->translationFlags)
+			&& (loadData->options == preparsedClassFile->options)
+		) {
+			parsedClassFile = (J9CfrClassFile *)preparsedClassFile->buffer;
+			preparsedClassFile->classData = NULL;
+		}
+	}
+	return parsedClassFile;
+}
+
 extern "C"  IDATA
 j9bcutil_buildRomClass(J9LoadROMClassData *loadData, U_8 * intermediateData, UDATA intermediateDataLength, J9JavaVM *javaVM, UDATA bctFlags, UDATA classFileBytesReplaced, UDATA isIntermediateROMClass, J9TranslationLocalBuffer *localBuffer)
 {
@@ -185,7 +210,7 @@ j9bcutil_buildRomClass(J9LoadROMClassData *loadData, U_8 * intermediateData, UDA
 			loadData->className, loadData->classNameLength, intermediateData, (U_32) intermediateDataLength, loadData->romClass, loadData->classBeingRedefined,
 			loadData->classLoader, (0 != classFileBytesReplaced), (TRUE == isIntermediateROMClass), localBuffer);
 
-	BuildResult result = romClassBuilder->buildROMClass(&context);
+	BuildResult result = romClassBuilder->buildROMClass(&context, takePreparsedClassFile(loadData, bctFlags, localBuffer));
 	loadData->romClass = context.romClass();
 	context.reportStatistics(localBuffer);
 
@@ -206,7 +231,7 @@ j9bcutil_transformROMClass(J9JavaVM *javaVM, J9PortLibrary *portLibrary, J9ROMCl
 
 
 BuildResult
-ROMClassBuilder::buildROMClass(ROMClassCreationContext *context)
+ROMClassBuilder::buildROMClass(ROMClassCreationContext *context, J9CfrClassFile *parsedClassFile)
 {
 	BuildResult result = OK;
 	ROMClassVerbosePhase v0(context, ROMClassCreation, &result);
@@ -215,7 +240,11 @@ ROMClassBuilder::buildROMClass(ROMClassCreationContext *context)
 
 	context->recordParseClassFileStart();
 	ClassFileParser classFileParser(_portLibrary, _verifyClassFunction);
-	result = classFileParser.parseClassFile(context, &_classFileParserBufferSize, &_classFileBuffer);
+	if (NULL != parsedClassFile) {
+		classFileParser.setParsedClassFile(parsedClassFile);
+	} else {
+		result = classFileParser.parseClassFile(context, &_classFileParserBufferSize, &_classFileBuffer);
+	}
 	context->recordParseClassFileEnd();
 
 	if ( OK == result ) {
@@ -63,7 +63,12 @@ public:
 	 */
 	U_8 * releaseClassFileBuffer();
 
-	BuildResult buildROMClass(ROMClassCreationContext *context);
+	/**
+	 * Build a ROMClass from the class file bytes in context.
+	 * If parsedClassFile is not NULL it is used in place of parsing the bytes, and it may be
+	 * modified, so must not be used for another build.
+	 */
+	BuildResult buildROMClass(ROMClassCreationContext *context, J9CfrClassFile *parsedClassFile = NULL);
 
 protected:
 	void *operator new(size_t size, void *memoryPtr) { return memoryPtr; };
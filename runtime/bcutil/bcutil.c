@@ -347,6 +347,8 @@ initializeTranslationBuffers(J9PortLibrary * portLib, J9TranslationBufferSet * t
 
 	translationBuffers->internalLoadROMClassFunction = internalLoadROMClass;
 	translationBuffers->transformROMClassFunction = j9bcutil_transformROMClass;
+	translationBuffers->preparseClassFileFunction = j9bcutil_preparseClassFile;
+	translationBuffers->freePreparsedClassFileFunction = j9bcutil_freePreparsedClassFile;
 
 #if defined(J9VM_OPT_INVARIANT_INTERNING)
 	/* invariant interning support */
@@ -42,9 +42,12 @@ static void throwNoClassDefFoundError (J9VMThread* vmThread, J9LoadROMClassData
 static void reportROMClassLoadEvents (J9VMThread* vmThread, J9ROMClass* romClass, J9ClassLoader* classLoader);
 static J9Class* checkForExistingClass (J9VMThread* vmThread, J9LoadROMClassData * loadData);
 static UDATA callDynamicLoader(J9JavaVM * vm, J9LoadROMClassData *loadData, U_8 * intermediateClassData, UDATA intermediateClassDataLength, UDATA translationFlags, UDATA classFileBytesReplacedByRIA, UDATA classFileBytesReplacedByRCA, J9TranslationLocalBuffer *localBuffer);
+static UDATA computeTranslationFlags(J9VMThread *vmThread, J9LoadROMClassData *loadData);
 
 #define GET_CLASS_LOADER_FROM_ID(vm, classLoader) ((classLoader) != NULL ? (classLoader) : (vm)->systemClassLoader)
 
+#define PREPARSE_INITIAL_BUFFER_SIZE 4096
+
 /*
  * Warning: sender must hold class table mutex before calling.
  */
@@ -262,7 +265,7 @@ internalLoadROMClass(J9VMThread * vmThread, J9LoadROMClassData *loadData, J9Tran
 {
 	J9JavaVM * vm = vmThread->javaVM;
 	UDATA result;
-	UDATA translationFlags;
+	UDATA translationFlags = 0;
 	UDATA classFileBytesReplacedByRIA = FALSE;
 	UDATA classFileBytesReplacedByRCA = FALSE;
 	U_8 * intermediateClassData = loadData->classData;
@@ -429,78 +432,7 @@ internalLoadROMClass(J9VMThread * vmThread, J9LoadROMClassData *loadData, J9Tran
 		}
 	}
 
-	/* Set up translation flags */
-
-#ifdef J9VM_ENV_LITTLE_ENDIAN
-	translationFlags = BCT_LittleEndianOutput;
-#else
-	translationFlags = BCT_BigEndianOutput;
-#endif
-
-	/*
-	 * RECORD_ALL is set by shared classes when it wishes to keep all debug information in the cache
-	 * classCouldPossiblyBeShared() returns true when the classloader is a shared classes enabled loader AND the cache is NOT full
-	 *
-	 * do NOT attempt to strip debug information when RECORD_ALL is set AND the class could end up the cache.
-	 *
-	 */
-	if ((J9VM_DEBUG_ATTRIBUTE_RECORD_ALL == (vm->requiredDebugAttributes & J9VM_DEBUG_ATTRIBUTE_RECORD_ALL))
-			&& classCouldPossiblyBeShared(vmThread, loadData)) {
-		/* Shared Classes has requested that all debug information be kept and the class will be shared. */
-	} else {
-		/* either the class is not going to be shared  -or- shared classes does not require the debug information to be maintained */
-		UDATA stripFlags = 0;
-
-		if (0 == (vm->requiredDebugAttributes & J9VM_DEBUG_ATTRIBUTE_LOCAL_VARIABLE_TABLE)) {
-			stripFlags |= BCT_StripDebugVars;
-		}
-		if (0 == (vm->requiredDebugAttributes & J9VM_DEBUG_ATTRIBUTE_LINE_NUMBER_TABLE)) {
-			stripFlags |= BCT_StripDebugLines;
-		}
-		if (0 == (vm->requiredDebugAttributes & J9VM_DEBUG_ATTRIBUTE_SOURCE_FILE)) {
-			stripFlags |= BCT_StripDebugSource;
-		}
-		if (0 == (vm->requiredDebugAttributes & J9VM_DEBUG_ATTRIBUTE_SOURCE_DEBUG_EXTENSION)) {
-			stripFlags |= BCT_StripSourceDebugExtension;
-		}
-
-		if (stripFlags == (BCT_StripDebugVars | BCT_StripDebugLines | BCT_StripDebugSource | BCT_StripSourceDebugExtension)) {
-			stripFlags = BCT_StripDebugAttributes;
-		}
-		translationFlags |= stripFlags;
-	}
-
-	if ((0 == (loadData->options & J9_FINDCLASS_FLAG_UNSAFE)) &&
-		(0 != (vm->runtimeFlags & J9_RUNTIME_VERIFY))) {
-		translationFlags |= BCT_StaticVerification;
-	}
-
-	if (0 != (vm->runtimeFlags & J9_RUNTIME_XFUTURE)) {
-		translationFlags |= BCT_Xfuture;
-	} else {
-		/* Disable static verification for the bootstrap loader if Xfuture not present */
-		if ((vm->systemClassLoader == loadData->classLoader)
-		&& ((NULL == vm->bytecodeVerificationData) || (0 == (vm->bytecodeVerificationData->verificationFlags & J9_VERIFY_BOOTCLASSPATH_STATIC)))
-		&& ((NULL == vm->sharedCacheAPI) || (0 == (vm->sharedCacheAPI->xShareClassesPresent)))
-		) {
-			translationFlags &= ~BCT_StaticVerification;
-		}
-	}
-
-	/* Determine allowed class file version */
-
-#ifdef J9VM_OPT_SIDECAR
-	/* Jazz 107424: update the max class version number on 2.9 to v53.0 class files */
-	if (J2SE_VERSION(vm) >= J2SE_19) {
-		translationFlags |= BCT_Java9MajorVersionShifted;
-	} else if (J2SE_VERSION(vm) >= J2SE_18) {
-		translationFlags |= BCT_Java8MajorVersionShifted;
-	} else if (J2SE_VERSION(vm) >= J2SE_17) {
-		translationFlags |= BCT_Java7MajorVersionShifted;
-	} else if (J2SE_VERSION(vm) >= J2SE_16) {
-		translationFlags |= BCT_Java6MajorVersionShifted;
-	}
-#endif
+	translationFlags = computeTranslationFlags(vmThread, loadData);
 
 	/* TODO toss tracepoint?? Trc_BCU_internalLoadROMClass_AttemptExisting(vmThread, segment, romAvailable, bytesRequired); */
 	/* Attempt dynamic load */
@@ -616,11 +548,6 @@ callDynamicLoader(J9JavaVM * vm, J9LoadROMClassData *loadData, U_8 * intermediat
 	U_8 *intermediateData = NULL;
 	UDATA intermediateDataLength = 0;
 
-	/* Pass the verification of stackmaps control flags to be used by static verification (verifyClassFunction - j9bcv_verifyClassStructure) */
-	if (vm->bytecodeVerificationData) {
-		translationFlags |= (vm->bytecodeVerificationData->verificationFlags & (J9_VERIFY_IGNORE_STACK_MAPS | J9_VERIFY_NO_FALLBACK));
-	}
-
 	if (J9_ARE_ANY_BITS_SET(loadData->options, J9_FINDCLASS_FLAG_SHRC_ROMCLASS_EXISTS)) {
 		if (TRUE == classFileBytesReplacedByRCA) {
 			if (FALSE == classFileBytesReplacedByRIA) {
@@ -854,6 +781,176 @@ createROMClassFromClassFile(J9VMThread *currentThread, J9LoadROMClassData *loadD
 	return NULL;
 }
 
+/**
+ * Compute the flags used to translate the class file bytes described by loadData.
+ * The pre-parse below uses the same flags, so a class file parsed ahead of time is only
+ * used when it was parsed exactly the way the dynamic loader would have parsed it.
+ */
+static UDATA
+computeTranslationFlags(J9VMThread *vmThread, J9LoadROMClassData *loadData)
+{
+	J9JavaVM * vm = vmThread->javaVM;
+	UDATA translationFlags = 0;
+
+#ifdef J9VM_ENV_LITTLE_ENDIAN
+	translationFlags = BCT_LittleEndianOutput;
+#else
+	translationFlags = BCT_BigEndianOutput;
+#endif
+
+	/*
+	 * RECORD_ALL is set by shared classes when it wishes to keep all debug information in the cache
+	 * classCouldPossiblyBeShared() returns true when the classloader is a shared classes enabled loader AND the cache is NOT full
+	 *
+	 * do NOT attempt to strip debug information when RECORD_ALL is set AND the class could end up the cache.
+	 *
+	 */
+	if ((J9VM_DEBUG_ATTRIBUTE_RECORD_ALL == (vm->requiredDebugAttributes & J9VM_DEBUG_ATTRIBUTE_RECORD_ALL))
+			&& classCouldPossiblyBeShared(vmThread, loadData)) {
+		/* Shared Classes has requested that all debug information be kept and the class will be shared. */
+	} else {
+		/* either the class is not going to be shared  -or- shared classes does not require the debug information to be maintained */
+		UDATA stripFlags = 0;
+
+		if (0 == (vm->requiredDebugAttributes & J9VM_DEBUG_ATTRIBUTE_LOCAL_VARIABLE_TABLE)) {
+			stripFlags |= BCT_StripDebugVars;
+		}
+		if (0 == (vm->requiredDebugAttributes & J9VM_DEBUG_ATTRIBUTE_LINE_NUMBER_TABLE)) {
+			stripFlags |= BCT_StripDebugLines;
+		}
+		if (0 == (vm->requiredDebugAttributes & J9VM_DEBUG_ATTRIBUTE_SOURCE_FILE)) {
+			stripFlags |= BCT_StripDebugSource;
+		}
+		if (0 == (vm->requiredDebugAttributes & J9VM_DEBUG_ATTRIBUTE_SOURCE_DEBUG_EXTENSION)) {
+			stripFlags |= BCT_StripSourceDebugExtension;
+		}
+
+		if (stripFlags == (BCT_StripDebugVars | BCT_StripDebugLines | BCT_StripDebugSource | BCT_StripSourceDebugExtension)) {
+			stripFlags = BCT_StripDebugAttributes;
+		}
+		translationFlags |= stripFlags;
+	}
+
+	if ((0 == (loadData->options & J9_FINDCLASS_FLAG_UNSAFE)) &&
+		(0 != (vm->runtimeFlags & J9_RUNTIME_VERIFY))) {
+		translationFlags |= BCT_StaticVerification;
+	}
+
+	if (0 != (vm->runtimeFlags & J9_RUNTIME_XFUTURE)) {
+		translationFlags |= BCT_Xfuture;
+	} else {
+		/* Disable static verification for the bootstrap loader if Xfuture not present */
+		if ((vm->systemClassLoader == loadData->classLoader)
+		&& ((NULL == vm->bytecodeVerificationData) || (0 == (vm->bytecodeVerificationData->verificationFlags & J9_VERIFY_BOOTCLASSPATH_STATIC)))
+		&& ((NULL == vm->sharedCacheAPI) || (0 == (vm->sharedCacheAPI->xShareClassesPresent)))
+		) {
+			translationFlags &= ~BCT_StaticVerification;
+		}
+	}
+
+	/* Determine allowed class file version */
+
+#ifdef J9VM_OPT_SIDECAR
+	/* Jazz 107424: update the max class version number on 2.9 to v53.0 class files */
+	if (J2SE_VERSION(vm) >= J2SE_19) {
+		translationFlags |= BCT_Java9MajorVersionShifted;
+	} else if (J2SE_VERSION(vm) >= J2SE_18) {
+		translationFlags |= BCT_Java8MajorVersionShifted;
+	} else if (J2SE_VERSION(vm) >= J2SE_17) {
+		translationFlags |= BCT_Java7MajorVersionShifted;
+	} else if (J2SE_VERSION(vm) >= J2SE_16) {
+		translationFlags |= BCT_Java6MajorVersionShifted;
+	}
+#endif
+
+
+	/* Pass the verification of stackmaps control flags to be used by static verification (verifyClassFunction - j9bcv_verifyClassStructure) */
+	if (vm->bytecodeVerificationData) {
+		translationFlags |= (vm->bytecodeVerificationData->verificationFlags & (J9_VERIFY_IGNORE_STACK_MAPS | J9_VERIFY_NO_FALLBACK));
+	}
+
+	return translationFlags;
+}
+
+J9PreparsedClassFile *
+j9bcutil_preparseClassFile(J9VMThread *vmThread, U_8 *classData, UDATA classDataLength, J9ClassLoader *classLoader, UDATA options)
+{
+	J9JavaVM *vm = vmThread->javaVM;
+	J9PreparsedClassFile *preparsedClassFile = NULL;
+	J9LoadROMClassData loadData;
+	/* a first guess, doubled until the parsed class file fits */
+	UDATA bufferSize = PREPARSE_INITIAL_BUFFER_SIZE + (classDataLength * 2);
+	U_8 *buffer = NULL;
+	I_32 result = BCT_ERR_OUT_OF_ROM;
+	PORT_ACCESS_FROM_JAVAVM(vm);
+
+	/* The class load hooks may replace the bytes, in which case the parse would be wasted */
+	if (J9_EVENT_IS_HOOKED(vm->hookInterface, J9HOOK_VM_CLASS_LOAD_HOOK) || J9_EVENT_IS_HOOKED(vm->hookInterface, J9HOOK_VM_CLASS_LOAD_HOOK2)) {
+		return NULL;
+	}
+
+	memset(&loadData, 0, sizeof(J9LoadROMClassData));
+	loadData.classLoader = GET_CLASS_LOADER_FROM_ID(vm, classLoader);
+	if (J9_ARE_ALL_BITS_SET(options, J9_FINDCLASS_FLAG_ANON)) {
+		loadData.classLoader = vm->anonClassLoader;
+	}
+	loadData.options = options;
+
+	preparsedClassFile = (J9PreparsedClassFile *) j9mem_allocate_memory(sizeof(J9PreparsedClassFile), J9MEM_CATEGORY_CLASSES);
+	if (NULL == preparsedClassFile) {
+		return NULL;
+	}
+	preparsedClassFile->classData = classData;
+	preparsedClassFile->classDataLength = classDataLength;
+	preparsedClassFile->translationFlags = computeTranslationFlags(vmThread, &loadData);
+	preparsedClassFile->options = options;
+
+	while (BCT_ERR_OUT_OF_ROM == result) {
+		buffer = (U_8 *) j9mem_allocate_memory(bufferSize, J9MEM_CATEGORY_CLASSES);
+		if (NULL == buffer) {
+			break;
+		}
+		result = j9bcutil_readClassFileBytes(PORTLIB,
+				(NULL == vm->bytecodeVerificationData) ? NULL : j9bcv_verifyClassStructure,
+				classData, classDataLength,
+				buffer, bufferSize,
+				(U_32) preparsedClassFile->translationFlags,
+				NULL, NULL,
+				options, vm->romMethodSortThreshold);
+		if (BCT_ERR_OUT_OF_ROM == result) {
+			j9mem_free_memory(buffer);
+			buffer = NULL;
+			/* Check for overflow. */
+			if ((bufferSize * 2) <= bufferSize) {
+				break;
+			}
+			bufferSize = bufferSize * 2;
+		}
+	}
+
+	if (BCT_ERR_NO_ERROR != result) {
+		/* Leave the error to be reported when the class is defined */
+		Trc_BCU_preparseClassFile_Failed(vmThread, classDataLength, (IDATA) result);
+		j9mem_free_memory(buffer);
+		j9mem_free_memory(preparsedClassFile);
+		return NULL;
+	}
+
+	preparsedClassFile->buffer = buffer;
+	return preparsedClassFile;
+}
+
+void
+j9bcutil_freePreparsedClassFile(J9JavaVM *vm, J9PreparsedClassFile *preparsedClassFile)
+{
+	PORT_ACCESS_FROM_JAVAVM(vm);
+
+	if (NULL != preparsedClassFile) {
+		j9mem_free_memory(preparsedClassFile->buffer);
+		j9mem_free_memory(preparsedClassFile);
+	}
+}
+
 static UDATA 
 classCouldPossiblyBeShared(J9VMThread * vmThread, J9LoadROMClassData * loadData)
 {
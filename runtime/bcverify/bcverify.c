@@ -70,6 +70,12 @@
 #define OPT_BOOTCLASSPATH_STATIC "bootclasspathstatic"
 #define OPT_DO_PROTECTED_ACCESS_CHECK "doProtectedAccessCheck"
 
+#define BCV_SHARED_RESULT_KEY_SIZE 48
+/* Verification flags which change the outcome of verifying a class, so are part of the key of a shared result */
+#define BCV_SHARED_RESULT_FLAGS (J9_VERIFY_IGNORE_STACK_MAPS | J9_VERIFY_NO_FALLBACK | J9_VERIFY_DO_PROTECTED_ACCESS_CHECK)
+/* Runtime flags the verifier reads (-Xfuture enables the protected access checks), so are part of the key of a shared result */
+#define BCV_SHARED_RESULT_RUNTIME_FLAGS (J9_RUNTIME_XFUTURE)
+
 static IDATA buildBranchMap (J9BytecodeVerificationData * verifyData);
 static IDATA decompressStackMaps (J9BytecodeVerificationData * verifyData, IDATA localsCount, U_8 * stackMapData);
 static VMINLINE IDATA parseLocals (J9BytecodeVerificationData * verifyData, U_8** stackMapData, J9BranchTargetStack * liveStack, IDATA localDelta, IDATA localsCount, IDATA maxLocals);
@@ -85,6 +91,9 @@ static IDATA simulateStack (J9BytecodeVerificationData * verifyData);
 
 static IDATA parseOptions (J9JavaVM *vm, char *optionValues, char **errorString);
 static IDATA setVerifyState ( J9JavaVM *vm, char *option, char **errorString );
+static UDATA getSharedVerificationResultKey (J9BytecodeVerificationData * verifyData, J9Class * clazz, J9ROMClass * romClass, char * key);
+static BOOLEAN findSharedVerificationResult (J9BytecodeVerificationData * verifyData, J9ROMClass * romClass, char * key, UDATA keyLength);
+static void storeSharedVerificationResult (J9BytecodeVerificationData * verifyData, J9ROMClass * romClass, char * key, UDATA keyLength);
 
 
 /**
@@ -2351,6 +2360,99 @@ error_no_memory:
 }
 
 
+/*
+ * Build the key under which the verification result of a ROM class in the shared classes cache is stored.
+ * The ROM class is identified by its offset in the cache, which is the same in every JVM attached to it.
+ *
+ * Results are not shared for verification which reports through the verbose hooks, uses -Xverify:excludeattribute=
+ * or checks class redefinition, as those depend on more than the ROM class and the verification flags.
+ *
+ * returns the length of the key, 0 if the result of verifying the class can not be shared
+ */
+static UDATA
+getSharedVerificationResultKey (J9BytecodeVerificationData * verifyData, J9Class * clazz, J9ROMClass * romClass, char * key)
+{
+	UDATA keyLength = 0;
+
+	if ((NULL != clazz)
+		&& verifyData->romClassInSharedClasses
+		&& (NULL == verifyData->redefinedClasses)
+		&& J9_ARE_NO_BITS_SET(verifyData->verificationFlags, J9_VERIFY_VERBOSE_VERIFICATION | J9_VERIFY_EXCLUDE_ATTRIBUTE)
+	) {
+		J9SharedClassCacheDescriptor *cache = verifyData->javaVM->sharedClassConfig->cacheDescriptorList;
+		UDATA cacheStart = (UDATA) cache->cacheStartAddress;
+
+		if ((NULL != verifyData->javaVM->sharedClassConfig->findSharedData)
+			&& ((UDATA) romClass >= cacheStart)
+			&& (((UDATA) romClass + romClass->romSize) <= (cacheStart + cache->cacheSizeBytes))
+		) {
+			PORT_ACCESS_FROM_JAVAVM(verifyData->javaVM);
+
+			keyLength = j9str_printf(PORTLIB, key, BCV_SHARED_RESULT_KEY_SIZE, "j9bcv:%zx:%x:%x",
+					(UDATA) romClass - cacheStart, (U_32) (verifyData->verificationFlags & BCV_SHARED_RESULT_FLAGS),
+					(U_32) (verifyData->javaVM->runtimeFlags & BCV_SHARED_RESULT_RUNTIME_FLAGS));
+		}
+	}
+
+	return keyLength;
+}
+
+
+/*
+ * returns TRUE if an earlier JVM stored a successful verification result for the ROM class, FALSE otherwise
+ */
+static BOOLEAN
+findSharedVerificationResult (J9BytecodeVerificationData * verifyData, J9ROMClass * romClass, char * key, UDATA keyLength)
+{
+	J9SharedClassConfig *sharedConfig = verifyData->javaVM->sharedClassConfig;
+	J9SharedDataDescriptor descriptor;
+	BOOLEAN found = FALSE;
+
+	if (0 < sharedConfig->findSharedData(verifyData->vmStruct, key, keyLength, J9SHR_DATA_TYPE_VM, FALSE, &descriptor, NULL)) {
+		J9BCVSharedVerificationResult *sharedResult = (J9BCVSharedVerificationResult *) descriptor.address;
+
+		if ((sizeof(J9BCVSharedVerificationResult) == descriptor.length)
+			&& (romClass->romSize == sharedResult->romSize)
+			&& ((U_32) (verifyData->verificationFlags & BCV_SHARED_RESULT_FLAGS) == sharedResult->verificationFlags)
+			&& ((U_32) (verifyData->javaVM->runtimeFlags & BCV_SHARED_RESULT_RUNTIME_FLAGS) == sharedResult->runtimeFlags)
+		) {
+			found = TRUE;
+		}
+	}
+
+	return found;
+}
+
+
+/*
+ * Record that the ROM class verified successfully.  Only called when verification looked up no RAM classes,
+ * so the result holds for the ROM class whichever class loader defines it.
+ */
+static void
+storeSharedVerificationResult (J9BytecodeVerificationData * verifyData, J9ROMClass * romClass, char * key, UDATA keyLength)
+{
+	J9SharedClassConfig *sharedConfig = verifyData->javaVM->sharedClassConfig;
+	J9BCVSharedVerificationResult sharedResult;
+	J9SharedDataDescriptor descriptor;
+
+	sharedResult.romSize = romClass->romSize;
+	sharedResult.verificationFlags = (U_32) (verifyData->verificationFlags & BCV_SHARED_RESULT_FLAGS);
+	sharedResult.runtimeFlags = (U_32) (verifyData->javaVM->runtimeFlags & BCV_SHARED_RESULT_RUNTIME_FLAGS);
+
+	memset(&descriptor, 0, sizeof(descriptor));
+	descriptor.address = (U_8 *) &sharedResult;
+	descriptor.length = sizeof(sharedResult);
+	descriptor.type = J9SHR_DATA_TYPE_VM;
+	descriptor.flags = J9SHRDATA_SINGLE_STORE_FOR_KEY_TYPE;
+
+	if (NULL != sharedConfig->storeSharedData(verifyData->vmStruct, key, keyLength, &descriptor)) {
+		Trc_BCV_j9bcv_verifyBytecodes_SharedResultStored(verifyData->vmStruct,
+				(UDATA) J9UTF8_LENGTH(J9ROMCLASS_CLASSNAME(romClass)),
+				J9UTF8_DATA(J9ROMCLASS_CLASSNAME(romClass)));
+	}
+}
+
+
 
 #define ALLOC_BUFFER(name, needed) \
 	if (needed > name##Size) { \
@@ -2394,6 +2496,8 @@ j9bcv_verifyBytecodes (J9PortLibrary * portLib, J9Class * clazz, J9ROMClass * ro
 	BOOLEAN classVersionRequiresStackmaps = romClass->majorVersion >= CFR_MAJOR_VERSION_REQUIRING_STACKMAPS;
 	BOOLEAN newFormat = (classVersionRequiresStackmaps || hasStackMaps);
 	BOOLEAN verboseVerification = (J9_VERIFY_VERBOSE_VERIFICATION == (verifyData->verificationFlags & J9_VERIFY_VERBOSE_VERIFICATION));
+	char sharedResultKey[BCV_SHARED_RESULT_KEY_SIZE];
+	UDATA sharedResultKeyLength = 0;
 
 	PORT_ACCESS_FROM_PORT(portLib);
 	
@@ -2420,6 +2524,16 @@ j9bcv_verifyBytecodes (J9PortLibrary * portLib, J9Class * clazz, J9ROMClass * ro
 		ALWAYS_TRIGGER_J9HOOK_VM_CLASS_VERIFICATION_START(verifyData->javaVM->hookInterface, verifyData, newFormat);
 	}
 
+	/* A shared ROM class already verified by another JVM only needs its class loading constraints checked */
+	sharedResultKeyLength = getSharedVerificationResultKey(verifyData, clazz, romClass, sharedResultKey);
+	if ((0 != sharedResultKeyLength) && findSharedVerificationResult(verifyData, romClass, sharedResultKey, sharedResultKeyLength)) {
+		Trc_BCV_j9bcv_verifyBytecodes_SharedResultFound(verifyData->vmStruct,
+				(UDATA) J9UTF8_LENGTH(J9ROMCLASS_CLASSNAME(romClass)),
+				J9UTF8_DATA(J9ROMCLASS_CLASSNAME(romClass)));
+		goto _checkConstraints;
+	}
+	verifyData->ramClassLookupCount = 0;
+
 	/* For each method in the class */
 	for (i = 0; i < (UDATA) romClass->romMethodCount; i++) {
 
@@ -2615,7 +2729,12 @@ _fallBack:
 		
 		romMethod = J9_NEXT_ROM_METHOD(romMethod);
 	}
-	
+
+	if ((0 != sharedResultKeyLength) && (BCV_SUCCESS == result) && (0 == verifyData->ramClassLookupCount)) {
+		storeSharedVerificationResult(verifyData, romClass, sharedResultKey, sharedResultKeyLength);
+	}
+
+_checkConstraints:
 	if (clazz && (result == BCV_SUCCESS)) {
 		verifyData->romMethod = checkAllClassLoadingConstraints (verifyData, clazz);
 		if (verifyData->romMethod) {
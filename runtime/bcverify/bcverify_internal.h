@@ -40,6 +40,13 @@
 extern "C" {
 #endif
 
+/* Record stored in the shared classes cache for a ROM class which verified successfully without looking up any RAM classes */
+typedef struct J9BCVSharedVerificationResult {
+	U_32 romSize;
+	U_32 verificationFlags;
+	U_32 runtimeFlags;
+} J9BCVSharedVerificationResult;
+
 /**
  * Store verification failure info to the J9BytecodeVerificationData
  * structure for outputting detailed error message.
@@ -61,6 +61,10 @@ j9rtv_verifierGetRAMClass( J9BytecodeVerificationData *verifyData, J9ClassLoader
     J9ThreadEnv* threadEnv;
 	(*jniVM)->GetEnv(jniVM, (void**)&threadEnv, J9THREAD_VERSION_1_1);
 
+	/* Counted before verifyData is saved for nested class loading so the count survives the restore.
+	 * A class whose verification looks up no RAM classes has a result independent of its class loader.
+	 */
+	verifyData->ramClassLookupCount += 1;
 
 #ifdef J9VM_THR_PREEMPTIVE
 	threadEnv->monitor_enter(verifyData->vmStruct->javaVM->classTableMutex);
@@ -121,6 +121,7 @@ static void performDecompile(J9VMThread * currentThread, J9JITDecompileState * d
 static void decompileOuterFrame(J9VMThread * currentThread, J9JITDecompileState * decompileState, J9JITDecompilationInfo * decompRecord, J9OSRFrame *osrFrame);
 static void markMethodBreakpointed(J9VMThread * currentThread, J9JITBreakpointedMethod * breakpointedMethod);
 static UDATA codeBreakpointAddedFrameIterator(J9VMThread * currentThread, J9StackWalkState * walkState);
+static UDATA codeBreakpointBatchFrameIterator(J9VMThread * currentThread, J9StackWalkState * walkState);
 static void  decompileAllMethodsInAllStacks(J9VMThread * currentThread, UDATA reason);
 static void markMethodUnbreakpointed(J9VMThread * currentThread, J9JITBreakpointedMethod * breakpointedMethod);
 static void reinstallAllBreakpoints(J9VMThread * currentThread);
@@ -384,23 +385,94 @@ jitCodeBreakpointAdded(J9VMThread * currentThread, J9Method * method)
 
 	breakpointedMethod->method = method;
 	breakpointedMethod->count = 1;
+	breakpointedMethod->stackScanPending = FALSE;
 	markMethodBreakpointed(currentThread, breakpointedMethod);
 
 	Trc_Decomp_jitCodeBreakpointAdded_hasBeenTranslated(currentThread, breakpointedMethod->hasBeenTranslated);
 
+	if (0 != jitConfig->codeBreakpointBatchDepth) {
+		/* The stacks are walked once for the whole batch when it ends */
+		breakpointedMethod->stackScanPending = TRUE;
+	} else {
+		loopThread = currentThread;
+		do {
+			J9StackWalkState walkState;
+
+			walkState.userData1 = method;
+			walkState.flags = J9_STACKWALK_ITERATE_FRAMES | J9_STACKWALK_SKIP_INLINES | J9_STACKWALK_VISIBLE_ONLY | J9_STACKWALK_ITERATE_HIDDEN_JIT_FRAMES | J9_STACKWALK_MAINTAIN_REGISTER_MAP;
+			walkState.skipCount = 0;
+			walkState.frameWalkFunction = codeBreakpointAddedFrameIterator;
+			walkState.walkThread = loopThread;
+			currentThread->javaVM->walkStackFrames(currentThread, &walkState);
+		} while ((loopThread = loopThread->linkNext) != currentThread);
+	}
+
+	Trc_Decomp_jitCodeBreakpointAdded_Exit(currentThread);
+}
+
+
+/*
+ * Begin a sequence of jitCodeBreakpointAdded calls made under a single exclusive VM access,
+ * such as reinstalling the breakpoints of redefined classes.  Rather than walking every
+ * thread stack for each newly breakpointed method, the stacks are walked once when the
+ * outermost batch ends.  Batches may nest.
+ */
+void
+jitCodeBreakpointBatchStarted(J9VMThread * currentThread)
+{
+	/* Called under exclusive access, so no mutex required */
+
+	currentThread->javaVM->jitConfig->codeBreakpointBatchDepth += 1;
+}
+
+
+void
+jitCodeBreakpointBatchEnded(J9VMThread * currentThread)
+{
+	PORT_ACCESS_FROM_VMC(currentThread);
+	J9JITConfig * jitConfig = currentThread->javaVM->jitConfig;
+	J9JITBreakpointedMethod * breakpointedMethod;
+	J9VMThread * loopThread;
+	UDATA pendingCount = 0;
+	UDATA threadCount = 0;
+	U_64 startTime = 0;
+
+	/* Called under exclusive access, so no mutex required */
+
+	if (0 != --(jitConfig->codeBreakpointBatchDepth)) {
+		return;
+	}
+
+	for (breakpointedMethod = jitConfig->breakpointedMethods; NULL != breakpointedMethod; breakpointedMethod = breakpointedMethod->link) {
+		if (breakpointedMethod->stackScanPending) {
+			pendingCount += 1;
+		}
+	}
+	if (0 == pendingCount) {
+		return;
+	}
+
+	Trc_Decomp_jitCodeBreakpointBatchEnded_Entry(currentThread, pendingCount);
+	startTime = j9time_hires_clock();
+
 	loopThread = currentThread;
 	do {
 		J9StackWalkState walkState;
 
-		walkState.userData1 = method;
+		walkState.userData1 = jitConfig->breakpointedMethods;
 		walkState.flags = J9_STACKWALK_ITERATE_FRAMES | J9_STACKWALK_SKIP_INLINES | J9_STACKWALK_VISIBLE_ONLY | J9_STACKWALK_ITERATE_HIDDEN_JIT_FRAMES | J9_STACKWALK_MAINTAIN_REGISTER_MAP;
 		walkState.skipCount = 0;
-		walkState.frameWalkFunction = codeBreakpointAddedFrameIterator;
+		walkState.frameWalkFunction = codeBreakpointBatchFrameIterator;
 		walkState.walkThread = loopThread;
 		currentThread->javaVM->walkStackFrames(currentThread, &walkState);
-	} while ((loopThread = loopThread->linkNext) != currentThread);	
+		threadCount += 1;
+	} while ((loopThread = loopThread->linkNext) != currentThread);
 
-	Trc_Decomp_jitCodeBreakpointAdded_Exit(currentThread);
+	for (breakpointedMethod = jitConfig->breakpointedMethods; NULL != breakpointedMethod; breakpointedMethod = breakpointedMethod->link) {
+		breakpointedMethod->stackScanPending = FALSE;
+	}
+
+	Trc_Decomp_jitCodeBreakpointBatchEnded_Exit(currentThread, threadCount, j9time_hires_delta(startTime, j9time_hires_clock(), J9PORT_TIME_DELTA_IN_MICROSECONDS));
 }
 
 
@@ -453,6 +525,29 @@ codeBreakpointAddedFrameIterator(J9VMThread * currentThread, J9StackWalkState *
 }
 
 
+static UDATA
+codeBreakpointBatchFrameIterator(J9VMThread * currentThread, J9StackWalkState * walkState)
+{
+	/* Decompile JIT frames running any method breakpointed during the batch */
+
+	if (walkState->jitInfo && J9_ARE_ANY_BITS_SET((UDATA) walkState->method->constantPool, J9_STARTPC_METHOD_BREAKPOINTED)) {
+		J9JITBreakpointedMethod * breakpointedMethod = (J9JITBreakpointedMethod *) walkState->userData1;
+
+		while (NULL != breakpointedMethod) {
+			if (breakpointedMethod->method == walkState->method) {
+				if (breakpointedMethod->stackScanPending) {
+					addDecompilation(currentThread, walkState, JITDECOMP_CODE_BREAKPOINT);
+				}
+				break;
+			}
+			breakpointedMethod = breakpointedMethod->link;
+		}
+	}
+
+	return J9_STACKWALK_KEEP_ITERATING;
+}
+
+
 #if (defined(J9VM_INTERP_HOT_CODE_REPLACEMENT)) /* priv. proto (autogen) */
 
 void  
@@ -1625,6 +1720,8 @@ initializeFSD(J9JavaVM * vm)
 
 	jitConfig->jitCodeBreakpointAdded = jitCodeBreakpointAdded;
 	jitConfig->jitCodeBreakpointRemoved = jitCodeBreakpointRemoved;
+	jitConfig->jitCodeBreakpointBatchStarted = jitCodeBreakpointBatchStarted;
+	jitConfig->jitCodeBreakpointBatchEnded = jitCodeBreakpointBatchEnded;
 	jitConfig->jitDataBreakpointAdded = jitDataBreakpointAdded;
 	jitConfig->jitDataBreakpointRemoved = jitDataBreakpointRemoved;
 	jitConfig->jitSingleStepAdded = jitSingleStepAdded;
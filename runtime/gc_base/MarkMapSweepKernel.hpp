@@ -0,0 +1,89 @@
+/*******************************************************************************
+ * Copyright (c) 2017, 2017 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#if !defined(MARKMAPSWEEPKERNEL_HPP_)
+#define MARKMAPSWEEPKERNEL_HPP_
+
+#include "j9.h"
+#include "modronbase.h"
+
+/**
+ * Mark map scanning primitives used by sweep to find runs of free memory.
+ * The sweep spends most of its time stepping over empty mark map slots, so rather than testing
+ * one slot per iteration the slots are tested a block at a time (256 bits of mark map on 64 bit
+ * platforms).  The block test has no per slot branches and compilers turn it into vector loads
+ * on targets which have them, while remaining plain integer code everywhere else.
+ * @ingroup GC_Base
+ */
+class MM_MarkMapSweepKernel
+{
+public:
+	enum {
+		SCAN_BLOCK_SLOTS = 4 /**< number of mark map slots tested per step of the block scan */
+	};
+
+	/**
+	 * Find the first mark map slot in the range which has at least one mark bit set.
+	 * @param current the first slot to examine
+	 * @param top the end of the range (exclusive)
+	 * @return the first non empty slot, or top if every slot in the range is empty
+	 */
+	MMINLINE static UDATA *
+	findMarkedSlot(UDATA *current, UDATA *top)
+	{
+		while ((UDATA)(top - current) >= SCAN_BLOCK_SLOTS) {
+			if (0 != (current[0] | current[1] | current[2] | current[3])) {
+				break;
+			}
+			current += SCAN_BLOCK_SLOTS;
+		}
+
+		/* finish the partial block, or locate the marked slot within the block found above */
+		while ((current < top) && (0 == *current)) {
+			current += 1;
+		}
+		return current;
+	}
+
+	/**
+	 * Slot at a time equivalent of findMarkedSlot(), kept as the reference the block scan is verified
+	 * and measured against.
+	 * @param current the first slot to examine
+	 * @param top the end of the range (exclusive)
+	 * @return the first non empty slot, or top if every slot in the range is empty
+	 */
+	MMINLINE static UDATA *
+	findMarkedSlotScalar(UDATA *current, UDATA *top)
+	{
+		while ((current < top) && (0 == *current)) {
+			current += 1;
+		}
+		return current;
+	}
+};
+
+#endif /* MARKMAPSWEEPKERNEL_HPP_ */
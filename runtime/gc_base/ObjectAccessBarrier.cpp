@@ -30,6 +30,7 @@
 
 #include "j9protos.h"
 #include "rommeth.h"
+#include "util_api.h"
 
 #include "ArrayletObjectModel.hpp"
 #include "AtomicOperations.hpp"
@@ -1978,6 +1979,46 @@ MM_ObjectAccessBarrier::doCopyContiguousForward(J9VMThread *vmThread, J9Indexabl
 	
 	return ARRAY_COPY_SUCCESSFUL;	
 }
+
+/**
+ * Copy forward without executing the write barrier, checking that each element may be stored into the
+ * destination array. Every slot is read once and stored exactly as it was checked. The class of the last
+ * element to pass the check is remembered, since large arrays usually hold runs of one class.
+ * @return ARRAY_COPY_SUCCESSFUL if all slots were copied, otherwise the source index of the element which
+ * failed the check (the slots before it have been copied)
+ */
+I_32
+MM_ObjectAccessBarrier::doCopyContiguousForwardWithCheck(J9VMThread *vmThread, J9IndexableObject *srcObject, J9IndexableObject *destObject, I_32 srcIndex, I_32 destIndex, I_32 lengthInSlots)
+{
+	J9Class *componentType = ((J9ArrayClass *)J9GC_J9OBJECT_CLAZZ(destObject))->componentType;
+	/* any object may be stored into an array of Object */
+	bool checkRequired = (0 != J9CLASS_DEPTH(componentType));
+	J9Class *lastStoredClazz = componentType;
+	fj9object_t *srcStartSlot = (fj9object_t *)indexableEffectiveAddress(vmThread, srcObject, srcIndex, sizeof(fj9object_t));
+	fj9object_t *srcSlot = srcStartSlot;
+	fj9object_t *destSlot = (fj9object_t *)indexableEffectiveAddress(vmThread, destObject, destIndex, sizeof(fj9object_t));
+	fj9object_t *srcEndSlot = srcSlot + lengthInSlots;
+
+	while (srcSlot < srcEndSlot) {
+		fj9object_t token = *srcSlot;
+		if (checkRequired) {
+			J9Object *copyObject = convertPointerFromToken(token);
+			if (NULL != copyObject) {
+				J9Class *storedClazz = J9GC_J9OBJECT_CLAZZ(copyObject);
+				if (storedClazz != lastStoredClazz) {
+					if (0 == instanceOfOrCheckCast(storedClazz, componentType)) {
+						return srcIndex + (I_32)(srcSlot - srcStartSlot);
+					}
+					lastStoredClazz = storedClazz;
+				}
+			}
+		}
+		*destSlot++ = token;
+		srcSlot += 1;
+	}
+
+	return ARRAY_COPY_SUCCESSFUL;
+}
 #endif /* J9VM_GC_ARRAYLETS */
 
 I_32
@@ -739,6 +739,14 @@ MM_RootScanner::scanMonitorLookupCaches(MM_EnvironmentBase *env)
 #endif /* J9VM_THR_LOCK_NURSERY */
 		}
 	}
+	if (_singleThread || J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+		/* the VM-wide cache which monitorTableAt() reads without holding the monitor table mutex */
+		j9objectmonitor_t *monitorTableLookupCache = static_cast<J9JavaVM*>(_omrVM->_language_vm)->monitorTableLookupCache;
+		UDATA cacheIndex = 0;
+		for (; cacheIndex < J9VM_MONITOR_TABLE_LOOKUP_CACHE_SIZE; cacheIndex++) {
+			doMonitorLookupCacheSlot(&monitorTableLookupCache[cacheIndex]);
+		}
+	}
 	reportScanningEnded(RootScannerEntity_MonitorLookupCaches);
 }
 
@@ -821,29 +829,42 @@ MM_RootScanner::scanRememberedSet(MM_EnvironmentBase *env)
 void
 MM_RootScanner::scanJVMTIObjectTagTables(MM_EnvironmentBase *env)
 {
-	if(_singleThread || J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
-		reportScanningStarted(RootScannerEntity_JVMTIObjectTagTables);
+	reportScanningStarted(RootScannerEntity_JVMTIObjectTagTables);
 
-		J9JVMTIData * jvmtiData = J9JVMTI_DATA_FROM_VM(static_cast<J9JavaVM*>(_omrVM->_language_vm));
-		J9JVMTIEnv * jvmtiEnv;
-		J9Object **slotPtr;
-		if (NULL != jvmtiData) {
-			/* TODO: When JVMTI is supported in RTSJ, this structure needs to be locked
-			 * when it is being scanned
-			 */
-			GC_JVMTIObjectTagTableListIterator objectTagTableList(jvmtiData->environments);
-			while(NULL != (jvmtiEnv = (J9JVMTIEnv *)objectTagTableList.nextSlot())) {
-				if (NULL != jvmtiEnv->objectTagTable) {
+	J9JVMTIData * jvmtiData = J9JVMTI_DATA_FROM_VM(static_cast<J9JavaVM*>(_omrVM->_language_vm));
+	J9JVMTIEnv * jvmtiEnv;
+	J9Object **slotPtr;
+	if (NULL != jvmtiData) {
+		OMRPORT_ACCESS_FROM_OMRVM(_omrVM);
+		U_64 scanTime = 0;
+
+		/* TODO: When JVMTI is supported in RTSJ, this structure needs to be locked
+		 * when it is being scanned
+		 */
+		GC_JVMTIObjectTagTableListIterator objectTagTableList(jvmtiData->environments);
+		while(NULL != (jvmtiEnv = (J9JVMTIEnv *)objectTagTableList.nextSlot())) {
+			if (NULL != jvmtiEnv->objectTagTable) {
+				/* Each environment owns its table, so different tables can be cleared by different threads.
+				 * A single table is always cleared by one thread, as removeSlot() unlinks entries from the
+				 * shared hash table and is not safe against another thread iterating the same table.
+				 */
+				if (_singleThread || J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+					U_64 startTime = omrtime_hires_clock();
 					GC_JVMTIObjectTagTableIterator objectTagTableIterator(jvmtiEnv->objectTagTable);
 					while(NULL != (slotPtr = (J9Object **)objectTagTableIterator.nextSlot())) {
 						doJVMTIObjectTagSlot(slotPtr, &objectTagTableIterator);
 					}
+					scanTime += omrtime_hires_clock() - startTime;
 				}
 			}
 		}
 
-		reportScanningEnded(RootScannerEntity_JVMTIObjectTagTables);
+		if (0 != scanTime) {
+			reportJVMTIObjectTagTablesScanTime(scanTime);
+		}
 	}
+
+	reportScanningEnded(RootScannerEntity_JVMTIObjectTagTables);
 }
 #endif /* J9VM_OPT_JVMTI */
 
@@ -418,6 +418,13 @@ public:
 
 #if defined(J9VM_OPT_JVMTI)
 	virtual void doJVMTIObjectTagSlot(J9Object **slotPtr, GC_JVMTIObjectTagTableIterator *objectTagTableIterator);
+
+	/**
+	 * Called once this thread has finished its share of the JVMTI object tag tables.
+	 * Ignored by default, overridden by scanners which report the cost of the tag tables.
+	 * @param scanTime hires clock ticks this thread spent on its object tag table work units
+	 */
+	virtual void reportJVMTIObjectTagTablesScanTime(U_64 scanTime) {}
 #endif /* J9VM_OPT_JVMTI */
 
 	virtual void doStringTableSlot(J9Object **slotPtr, GC_StringTableIterator *stringTableIterator);
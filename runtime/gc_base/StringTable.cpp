@@ -168,6 +168,29 @@ MM_StringTable::hashAtUTF8(UDATA tableIndex, U_8 *utf8Data, UDATA utf8Length, U_
 	return hashAt(tableIndex, (j9object_t)ptr);
 }
 
+j9object_t
+MM_StringTable::getStringInternCacheUTF8(J9JavaVM *javaVM, U_8 *utf8Data, UDATA utf8Length, U_32 hash)
+{
+	j9object_t candidate = *getStringInternCache(hash);
+
+	if (NULL != candidate) {
+		stringTableUTF8Query query;
+		void *ptr;
+
+		query.utf8Data = utf8Data;
+		query.utf8Length = utf8Length;
+		query.hash = hash;
+		ptr = &query;
+		ptr = (void *) ((UDATA) ptr | TYPE_UTF8); /* Least significant bit indicates that this is a pointer to a stringTableUTF8Query */
+		/* stringHashEqualFn also rejects candidates which are about to be cleared on metronome */
+		if (!stringHashEqualFn(&candidate, &ptr, javaVM)) {
+			candidate = NULL;
+		}
+	}
+
+	return candidate;
+}
+
 j9object_t
 MM_StringTable::hashAtPut(UDATA tableIndex, j9object_t string)
 {
@@ -562,11 +585,22 @@ j9gc_createJavaLangString(J9VMThread *vmThread, U_8 *data, UDATA length, UDATA s
 
 	if ((stringFlags & (J9_STR_XLAT | J9_STR_UNICODE)) == 0) {
 		U_32 hash = (U_32)vm->internalVMFunctions->computeHashForUTF8(data, length);
-		UDATA tableIndex = stringTable->getTableIndex(hash);
 
-		stringTable->lockTable(tableIndex);
-		result = stringTable->hashAtUTF8(tableIndex, data, length, hash);
-		stringTable->unlockTable(tableIndex);
+		/* try the lock-free cache before contending on the sub-table lock */
+		result = stringTable->getStringInternCacheUTF8(vm, data, length, hash);
+		if (NULL != result) {
+			Trc_MM_stringTableCacheHit(vmThread, result);
+		} else {
+			UDATA tableIndex = stringTable->getTableIndex(hash);
+
+			stringTable->lockTable(tableIndex);
+			result = stringTable->hashAtUTF8(tableIndex, data, length, hash);
+			stringTable->unlockTable(tableIndex);
+
+			if (NULL != result) {
+				*stringTable->getStringInternCache(hash) = result;
+			}
+		}
 	}
 
 	if (NULL == result) {
@@ -866,11 +900,18 @@ j9gc_allocStringWithSharedCharData(J9VMThread *vmThread, U_8 *data, UDATA length
 	/* see if the string is already in the table. Race condition where another thread may add the string
 	 * before this one is not fatal and is ignored.
 	 */
+	internedString = stringTable->getStringInternCacheUTF8(vm, data, length, hash);
+	if (internedString != NULL) {
+		Trc_MM_stringTableCacheHit(vmThread, internedString);
+		return internedString;
+	}
+
 	stringTable->lockTable(tableIndex);
 	internedString = stringTable->hashAtUTF8(tableIndex, data, length, hash);
 	stringTable->unlockTable(tableIndex);
 
 	if (internedString != NULL) {
+		*stringTable->getStringInternCache(hash) = internedString;
 		return internedString;
 	}
 
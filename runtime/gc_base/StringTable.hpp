@@ -65,6 +65,16 @@ public:
 	 */
 	j9object_t *getStringInternCache(UDATA hash) { return  &_cache[hash % cacheSize]; }
 
+	/**
+	 * Look up a UTF8 string in the interned string cache without taking any sub-table lock.
+	 * @param javaVM pointer to the J9JavaVM
+	 * @param utf8Data pointer to UTF8 string data
+	 * @param utf8Length length of the string
+	 * @param hash hash value of the string
+	 * @return pointer to the cached interned String object or NULL if the cache entry does not match
+	 */
+	j9object_t getStringInternCacheUTF8(J9JavaVM *javaVM, U_8 *utf8Data, UDATA utf8Length, U_32 hash);
+
 	/**
 	 * @return hash sub-table count
 	 */
@@ -136,7 +136,7 @@ void
 GC_VMInterface::lockJNIGlobalReferences(MM_GCExtensions *extensions)
 {
 #if defined(J9VM_THR_PREEMPTIVE)
-	omrthread_monitor_enter(((J9JavaVM *)extensions->getOmrVM()->_language_vm)->jniFrameMutex);
+	omrthread_monitor_enter(((J9JavaVM *)extensions->getOmrVM()->_language_vm)->jniGlobalReferencesMutex);
 #endif /* J9VM_THR_PREEMPTIVE */
 }
 
@@ -147,7 +147,7 @@ void
 GC_VMInterface::unlockJNIGlobalReferences(MM_GCExtensions *extensions)
 {
 #if defined(J9VM_THR_PREEMPTIVE)
-	omrthread_monitor_exit(((J9JavaVM *)extensions->getOmrVM()->_language_vm)->jniFrameMutex);
+	omrthread_monitor_exit(((J9JavaVM *)extensions->getOmrVM()->_language_vm)->jniGlobalReferencesMutex);
 #endif /* J9VM_THR_PREEMPTIVE */
 }
 
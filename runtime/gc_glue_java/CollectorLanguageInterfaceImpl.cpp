@@ -844,6 +844,11 @@ MM_CollectorLanguageInterfaceImpl::scavenger_mergeGCStats_mergeLangStats(MM_Envi
 	finalGCJavaStats->_weakReferenceStats.merge(&scavJavaStats->_weakReferenceStats);
 	finalGCJavaStats->_softReferenceStats.merge(&scavJavaStats->_softReferenceStats);
 	finalGCJavaStats->_phantomReferenceStats.merge(&scavJavaStats->_phantomReferenceStats);
+
+	finalGCJavaStats->_jvmtiObjectTagCandidates += scavJavaStats->_jvmtiObjectTagCandidates;
+	finalGCJavaStats->_jvmtiObjectTagCleared += scavJavaStats->_jvmtiObjectTagCleared;
+	/* the threads fix up their tables in parallel, so the pause grows by the slowest thread's time */
+	finalGCJavaStats->_jvmtiObjectTagTime = OMR_MAX(finalGCJavaStats->_jvmtiObjectTagTime, scavJavaStats->_jvmtiObjectTagTime);
 }
 
 void
@@ -371,7 +371,15 @@ MM_MarkingSchemeRootClearer::doStringCacheTableSlot(omrobjectptr_t *slotPtr)
 void
 MM_MarkingSchemeRootClearer::doJVMTIObjectTagSlot(omrobjectptr_t *slotPtr, GC_JVMTIObjectTagTableIterator *objectTagTableIterator)
 {
+	_env->getGCEnvironment()->_markJavaStats._jvmtiObjectTagCandidates += 1;
 	if(!_markingScheme->isMarked(*slotPtr)) {
+		_env->getGCEnvironment()->_markJavaStats._jvmtiObjectTagCleared += 1;
 		objectTagTableIterator->removeSlot();
 	}
 }
+
+void
+MM_MarkingSchemeRootClearer::reportJVMTIObjectTagTablesScanTime(U_64 scanTime)
+{
+	_env->getGCEnvironment()->_markJavaStats._jvmtiObjectTagTime += scanTime;
+}
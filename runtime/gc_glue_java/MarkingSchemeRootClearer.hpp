@@ -71,6 +71,7 @@ public:
 	virtual void doStringTableSlot(omrobjectptr_t *slotPtr, GC_StringTableIterator *stringTableIterator);
 	virtual void doStringCacheTableSlot(omrobjectptr_t *slotPtr);
 	virtual void doJVMTIObjectTagSlot(omrobjectptr_t *slotPtr, GC_JVMTIObjectTagTableIterator *objectTagTableIterator);
+	virtual void reportJVMTIObjectTagTablesScanTime(U_64 scanTime);
 	virtual void doFinalizableObject(omrobjectptr_t object);
 
 protected:
@@ -221,11 +221,22 @@ public:
 	doJVMTIObjectTagSlot(omrobjectptr_t *slotPtr, GC_JVMTIObjectTagTableIterator *objectTagTableIterator)
 	{
 		omrobjectptr_t objectPtr = *slotPtr;
+		_env->getGCEnvironment()->_scavengerJavaStats._jvmtiObjectTagCandidates += 1;
 		if(objectPtr && _scavenger->isObjectInEvacuateMemory(objectPtr)) {
 			MM_ForwardedHeader forwardedHeader(objectPtr);
 			*slotPtr = forwardedHeader.getForwardedObject();
+			if (NULL == *slotPtr) {
+				/* the tag is unlinked by the JVMTI GC end hook */
+				_env->getGCEnvironment()->_scavengerJavaStats._jvmtiObjectTagCleared += 1;
+			}
 		}
 	}
+
+	virtual void
+	reportJVMTIObjectTagTablesScanTime(U_64 scanTime)
+	{
+		_env->getGCEnvironment()->_scavengerJavaStats._jvmtiObjectTagTime += scanTime;
+	}
 #endif /* J9VM_OPT_JVMTI */
 #if defined(J9VM_GC_FINALIZATION)
 	virtual void
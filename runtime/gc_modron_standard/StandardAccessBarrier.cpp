@@ -558,6 +558,31 @@ MM_StandardAccessBarrier::forwardReferenceArrayCopyIndex(J9VMThread *vmThread, J
 	}
 	return retValue;
 }
+
+/**
+ * Type checked forward copy which executes a single batch barrier on the destination rather than a barrier per slot.
+ * @return ARRAY_COPY_SUCCESSFUL if copy was successful, ARRAY_COPY_NOT_DONE no copy is done,
+ * otherwise the index of the element which could not be stored
+ */
+I_32
+MM_StandardAccessBarrier::forwardReferenceArrayCopyWithCheckIndex(J9VMThread *vmThread, J9IndexableObject *srcObject, J9IndexableObject *destObject, I_32 srcIndex, I_32 destIndex, I_32 lengthInSlots)
+{
+	I_32 retValue = ARRAY_COPY_NOT_DONE;
+
+	if(0 == lengthInSlots) {
+		retValue = ARRAY_COPY_SUCCESSFUL;
+	} else {
+		Assert_MM_true(_extensions->indexableObjectModel.isInlineContiguousArraylet(destObject));
+		Assert_MM_true(_extensions->indexableObjectModel.isInlineContiguousArraylet(srcObject));
+
+		if (!_extensions->isConcurrentScavengerEnabled()) {
+			retValue = doCopyContiguousForwardWithCheck(vmThread, srcObject, destObject, srcIndex, destIndex, lengthInSlots);
+			/* a failed check still leaves the slots before it copied */
+			preBatchObjectStoreImpl(vmThread, (J9Object *)destObject);
+		}
+	}
+	return retValue;
+}
 #endif /* J9VM_GC_ARRAYLETS */
 
 J9Object*
@@ -194,6 +194,15 @@ backwardReferenceArrayCopyAndAlwaysWrtbarIndex(J9VMThread *vmThread, J9Indexable
 I_32 
 forwardReferenceArrayCopyWithCheckAndAlwaysWrtbarIndex(J9VMThread *vmThread, J9IndexableObject *srcObject, J9IndexableObject *destObject, I_32 srcIndex, I_32 destIndex, I_32 lengthInSlots)
 {
+	MM_ObjectAccessBarrier *barrier = MM_GCExtensions::getExtensions(vmThread->javaVM)->accessBarrier;
+	I_32 result;
+
+	/* Let access barrier specific code try doing an optimized version of the copy (if such exists) */
+	/* -1 copy successful, -2 no copy done, >=0 copy was attempted but and exception was raised (index returned) */
+	if (-1 <= (result = barrier->forwardReferenceArrayCopyWithCheckIndex(vmThread, srcObject, destObject, srcIndex, destIndex, lengthInSlots))) {
+		return result;
+	}
+
 	I_32 srcEndIndex = srcIndex + lengthInSlots;
 	
 	while (srcIndex < srcEndIndex) {
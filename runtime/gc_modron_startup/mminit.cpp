@@ -452,7 +452,11 @@ j9gc_initialize_heap(J9JavaVM *vm, UDATA heapBytesRequested)
 		goto error_no_memory;
 	}
 
-	extensions->stringTable = MM_StringTable::newInstance(&env, extensions->dispatcher->threadCountMaximum());
+	if (0 == extensions->stringTableCount) {
+		/* intern contention comes from mutator threads as well as GC threads, so size the sub-table count for both */
+		extensions->stringTableCount = OMR_MAX(extensions->dispatcher->threadCountMaximum(), j9sysinfo_get_number_CPUs_by_type(J9PORT_CPU_ONLINE));
+	}
+	extensions->stringTable = MM_StringTable::newInstance(&env, extensions->stringTableCount);
 	if (NULL == extensions->stringTable) {
 		goto error_no_memory;
 	}
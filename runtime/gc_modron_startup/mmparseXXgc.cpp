@@ -347,6 +347,14 @@ gcParseXXgcArguments(J9JavaVM *vm, char *optArg)
 			extensions->tarokEnableExpensiveAssertions = false;
 			continue;
 		}
+		if (try_scan(&scan_start, "tarokEnableCopyForwardNumaAffinity")) {
+			extensions->tarokEnableCopyForwardNumaAffinity = true;
+			continue;
+		}
+		if (try_scan(&scan_start, "tarokDisableCopyForwardNumaAffinity")) {
+			extensions->tarokEnableCopyForwardNumaAffinity = false;
+			continue;
+		}
 		if (try_scan(&scan_start, "tarokTgcEnableRememberedSetDuplicateDetection")) {
 			extensions->tarokTgcEnableRememberedSetDuplicateDetection = true;
 			continue;
@@ -1149,6 +1157,19 @@ gcParseXXgcArguments(J9JavaVM *vm, char *optArg)
 			continue;
 		}
 
+		if (try_scan(&scan_start, "stringTableCount=")) {
+			if(!scan_udata_helper(vm, &scan_start, &(extensions->stringTableCount), "stringTableCount=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			if (0 == extensions->stringTableCount) {
+				j9nls_printf(PORTLIB, J9NLS_ERROR, J9NLS_GC_OPTIONS_VALUE_MUST_BE_ABOVE, "stringTableCount=", (UDATA)0);
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			continue;
+		}
+
 		if (try_scan(&scan_start, "objectListFragmentCount=")) {
 			if(!scan_udata_helper(vm, &scan_start, &(extensions->objectListFragmentCount), "objectListFragmentCount=")) {
 				returnValue = JNI_EINVAL;
@@ -307,6 +307,13 @@ MM_RealtimeRootScanner::scanMonitorLookupCaches(MM_EnvironmentBase *env)
 			}
 		}
 	}
+	/* The VM-wide cache is shared by all threads. Clearing it again from another GC thread is harmless,
+	 * and mutators can only re-insert monitors for objects they can reach, which will not be freed.
+	 */
+	j9objectmonitor_t *monitorTableLookupCache = static_cast<J9JavaVM*>(_omrVM->_language_vm)->monitorTableLookupCache;
+	for (UDATA cacheIndex = 0; cacheIndex < J9VM_MONITOR_TABLE_LOOKUP_CACHE_SIZE; cacheIndex++) {
+		doMonitorLookupCacheSlot(&monitorTableLookupCache[cacheIndex]);
+	}
 	reportScanningEnded(RootScannerEntity_MonitorLookupCaches);
 }
 
@@ -64,6 +64,12 @@ public:
 	UDATA _stringConstantsCleared;  /**< The number of string constants that have been cleared during marking */
 	UDATA _stringConstantsCandidates; /**< The number of string constants that have been visited in string table during marking */
 
+	UDATA _jvmtiObjectTagCandidates; /**< The number of JVMTI tagged objects visited in the object tag tables during copy forward */
+	U_64 _jvmtiObjectTagTime; /**< hires clock time spent forwarding the object tag tables; once merged, that of the slowest thread */
+
+	UDATA _copyObjectsCrossNode; /**< The number of objects copied into a survivor region on a different NUMA node than the region they were evacuated from */
+	UDATA _copyBytesCrossNode; /**< The number of bytes copied into a survivor region on a different NUMA node than the region they were evacuated from */
+
 private:
 	
 	/* 
@@ -87,6 +93,12 @@ public:
 
 		_stringConstantsCleared = 0;
 		_stringConstantsCandidates = 0;
+
+		_jvmtiObjectTagCandidates = 0;
+		_jvmtiObjectTagTime = 0;
+
+		_copyObjectsCrossNode = 0;
+		_copyBytesCrossNode = 0;
 	}
 	
 	/**
@@ -106,6 +118,13 @@ public:
 
 		_stringConstantsCleared += stats->_stringConstantsCleared;
 		_stringConstantsCandidates += stats->_stringConstantsCandidates;
+
+		_jvmtiObjectTagCandidates += stats->_jvmtiObjectTagCandidates;
+		/* each tag table is forwarded by a single thread, so the pause grows by the slowest thread's time */
+		_jvmtiObjectTagTime = OMR_MAX(_jvmtiObjectTagTime, stats->_jvmtiObjectTagTime);
+
+		_copyObjectsCrossNode += stats->_copyObjectsCrossNode;
+		_copyBytesCrossNode += stats->_copyBytesCrossNode;
 	}
 
 	MM_CopyForwardStats() :
@@ -119,6 +138,10 @@ public:
 		,_phantomReferenceStats()
 		,_stringConstantsCleared(0)
 		,_stringConstantsCandidates(0)
+		,_jvmtiObjectTagCandidates(0)
+		,_jvmtiObjectTagTime(0)
+		,_copyObjectsCrossNode(0)
+		,_copyBytesCrossNode(0)
 	{}
 };
 
@@ -42,6 +42,10 @@ MM_MarkJavaStats::clear()
 	_stringConstantsCleared = 0;
 	_stringConstantsCandidates = 0;
 
+	_jvmtiObjectTagCandidates = 0;
+	_jvmtiObjectTagCleared = 0;
+	_jvmtiObjectTagTime = 0;
+
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	splitArraysProcessed = 0;
 	splitArraysAmount = 0;
@@ -64,6 +68,11 @@ MM_MarkJavaStats::merge(MM_MarkJavaStats* statsToMerge)
 	_stringConstantsCleared += statsToMerge->_stringConstantsCleared;
 	_stringConstantsCandidates += statsToMerge->_stringConstantsCandidates;
 
+	_jvmtiObjectTagCandidates += statsToMerge->_jvmtiObjectTagCandidates;
+	_jvmtiObjectTagCleared += statsToMerge->_jvmtiObjectTagCleared;
+	/* the threads clear their tables in parallel, so the pause grows by the slowest thread's time */
+	_jvmtiObjectTagTime = OMR_MAX(_jvmtiObjectTagTime, statsToMerge->_jvmtiObjectTagTime);
+
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	/* It may not ever be useful to merge these stats, but do it anyways */
 	splitArraysProcessed += statsToMerge->splitArraysProcessed;
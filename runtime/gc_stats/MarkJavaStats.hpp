@@ -53,6 +53,10 @@ public:
 	UDATA _stringConstantsCleared; /**< The number of string constants that have been cleared during marking */
 	UDATA _stringConstantsCandidates; /**< The number of string constants that have been visited in string table during marking */
 
+	UDATA _jvmtiObjectTagCandidates; /**< The number of JVMTI tagged objects visited in the object tag tables during marking */
+	UDATA _jvmtiObjectTagCleared; /**< The number of JVMTI object tags removed because their object died */
+	U_64 _jvmtiObjectTagTime; /**< hires clock time spent clearing the object tag tables; once merged, that of the slowest thread */
+
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	UDATA splitArraysProcessed; /**< The number of array chunks (not counting parts smaller than the split size) processed by this thread */
 	UDATA splitArraysAmount;
@@ -76,6 +80,9 @@ public:
 		, _phantomReferenceStats()
 		, _stringConstantsCleared(0)
 		, _stringConstantsCandidates(0)
+		, _jvmtiObjectTagCandidates(0)
+		, _jvmtiObjectTagCleared(0)
+		, _jvmtiObjectTagTime(0)
 	{
 		clear();
 	}
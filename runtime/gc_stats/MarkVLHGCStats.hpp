@@ -68,6 +68,10 @@ public:
 	UDATA _stringConstantsCleared;  /**< The number of string constants that have been cleared during marking */
 	UDATA _stringConstantsCandidates; /**< The number of string constants that have been visited in string table during marking */
 
+	UDATA _jvmtiObjectTagCandidates; /**< The number of JVMTI tagged objects visited in the object tag tables during marking */
+	UDATA _jvmtiObjectTagCleared; /**< The number of JVMTI object tags removed because their object died */
+	U_64 _jvmtiObjectTagTime; /**< hires clock time spent clearing the object tag tables; once merged, that of the slowest thread */
+
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	UDATA _splitArraysProcessed; /**< The number of array chunks (not counting parts smaller than the split size) processed by this thread */
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
@@ -94,6 +98,10 @@ public:
 		_stringConstantsCleared = 0;
 		_stringConstantsCandidates = 0;
 
+		_jvmtiObjectTagCandidates = 0;
+		_jvmtiObjectTagCleared = 0;
+		_jvmtiObjectTagTime = 0;
+
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 		_splitArraysProcessed = 0;
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
@@ -116,6 +124,11 @@ public:
 		_stringConstantsCleared += statsToMerge->_stringConstantsCleared;
 		_stringConstantsCandidates += statsToMerge->_stringConstantsCandidates;
 
+		_jvmtiObjectTagCandidates += statsToMerge->_jvmtiObjectTagCandidates;
+		_jvmtiObjectTagCleared += statsToMerge->_jvmtiObjectTagCleared;
+		/* each tag table is cleared by a single thread, so the pause grows by the slowest thread's time */
+		_jvmtiObjectTagTime = OMR_MAX(_jvmtiObjectTagTime, statsToMerge->_jvmtiObjectTagTime);
+
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 		/* It may not ever be useful to merge these stats, but do it anyways */
 		_splitArraysProcessed += statsToMerge->_splitArraysProcessed;
@@ -134,6 +147,9 @@ public:
 		,_phantomReferenceStats()
 		,_stringConstantsCleared(0)
 		,_stringConstantsCandidates(0)
+		,_jvmtiObjectTagCandidates(0)
+		,_jvmtiObjectTagCleared(0)
+		,_jvmtiObjectTagTime(0)
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 		,_splitArraysProcessed(0)
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
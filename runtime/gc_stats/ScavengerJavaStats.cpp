@@ -32,6 +32,9 @@ MM_ScavengerJavaStats::MM_ScavengerJavaStats() :
 	,_weakReferenceStats()
 	,_softReferenceStats()
 	,_phantomReferenceStats()
+	,_jvmtiObjectTagCandidates(0)
+	,_jvmtiObjectTagCleared(0)
+	,_jvmtiObjectTagTime(0)
 {
 }
 
@@ -48,6 +51,10 @@ MM_ScavengerJavaStats::clear()
 	_weakReferenceStats.clear();
 	_softReferenceStats.clear();
 	_phantomReferenceStats.clear();
+
+	_jvmtiObjectTagCandidates = 0;
+	_jvmtiObjectTagCleared = 0;
+	_jvmtiObjectTagTime = 0;
 };
 
 
@@ -58,6 +58,10 @@ public:
 	MM_ReferenceStats _softReferenceStats;  /**< Soft reference stats for the cycle */
 	MM_ReferenceStats _phantomReferenceStats;  /**< Phantom reference stats for the cycle */
 
+	UDATA _jvmtiObjectTagCandidates;  /**< number of JVMTI tagged objects visited in the object tag tables this cycle */
+	UDATA _jvmtiObjectTagCleared;  /**< number of JVMTI object tags cleared because their object died this cycle */
+	U_64 _jvmtiObjectTagTime;  /**< hires clock time spent fixing up the object tag tables; once merged, that of the slowest thread */
+
 protected:
 
 private:
@@ -0,0 +1,98 @@
+/*******************************************************************************
+ * Copyright (c) 2017, 2017 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ *******************************************************************************/
+
+/**
+ * Times the sweep mark map scans against each other. This is a measurement, not a test: it is
+ * built as its own executable so that the gc_sweeptest sanity run stays deterministic.
+ */
+
+#include "j9.h"
+#include "exelib_api.h"
+
+#include "sweepmaps.hpp"
+
+#define BENCHMARK_MAP_SLOTS (2 * 1024 * 1024)
+#define BENCHMARK_ITERATIONS 16
+
+/**
+ * Sweep synthetic mark maps of decreasing density with both scans and report how long each took.
+ * @return 0 on success, 1 if the map could not be allocated or the scans disagreed
+ */
+static UDATA
+runSweepBenchmark(J9PortLibrary *portLibrary)
+{
+	PORT_ACCESS_FROM_PORT(portLibrary);
+	UDATA liveRatios[] = { 1, 4, 32, 256, 4096, 0 };
+	UDATA *map = (UDATA *)j9mem_allocate_memory(BENCHMARK_MAP_SLOTS * sizeof(UDATA), OMRMEM_CATEGORY_MM);
+	UDATA rc = 0;
+
+	if (NULL == map) {
+		j9tty_err_printf(PORTLIB, "Unable to allocate the mark map\n");
+		return 1;
+	}
+
+	for (UDATA ratio = 0; ratio < sizeof(liveRatios) / sizeof(liveRatios[0]); ratio++) {
+		SweepSummary scalarSummary;
+		SweepSummary blockSummary;
+		U_64 startTime = 0;
+		U_64 scalarTime = 0;
+		U_64 blockTime = 0;
+
+		fillMarkMap(map, BENCHMARK_MAP_SLOTS, liveRatios[ratio]);
+
+		startTime = j9time_hires_clock();
+		for (UDATA i = 0; i < BENCHMARK_ITERATIONS; i++) {
+			sweepMarkMap(MM_MarkMapSweepKernel::findMarkedSlotScalar, map, BENCHMARK_MAP_SLOTS, &scalarSummary);
+		}
+		scalarTime = j9time_hires_delta(startTime, j9time_hires_clock(), J9PORT_TIME_DELTA_IN_MICROSECONDS);
+
+		startTime = j9time_hires_clock();
+		for (UDATA i = 0; i < BENCHMARK_ITERATIONS; i++) {
+			sweepMarkMap(MM_MarkMapSweepKernel::findMarkedSlot, map, BENCHMARK_MAP_SLOTS, &blockSummary);
+		}
+		blockTime = j9time_hires_delta(startTime, j9time_hires_clock(), J9PORT_TIME_DELTA_IN_MICROSECONDS);
+
+		if ((scalarSummary.freeRuns != blockSummary.freeRuns)
+			|| (scalarSummary.freeSlots != blockSummary.freeSlots)
+			|| (scalarSummary.liveSlots != blockSummary.liveSlots)
+		) {
+			/* gc_sweeptest reports the details, a mismatch only invalidates the timings here */
+			j9tty_err_printf(PORTLIB, "slot scan and block scan disagree at live ratio %zu\n", liveRatios[ratio]);
+			rc = 1;
+		}
+
+		j9tty_printf(PORTLIB, "sweep of %zu slots x %u, %zu live, %zu free runs: slot scan %llu usec, block scan %llu usec\n",
+			(UDATA)BENCHMARK_MAP_SLOTS, BENCHMARK_ITERATIONS, blockSummary.liveSlots, blockSummary.freeRuns, scalarTime, blockTime);
+	}
+
+	j9mem_free_memory(map);
+	return rc;
+}
+
+extern "C" {
+
+UDATA
+signalProtectedMain(struct J9PortLibrary *portLibrary, void *arg)
+{
+	return runSweepBenchmark(portLibrary);
+}
+
+}
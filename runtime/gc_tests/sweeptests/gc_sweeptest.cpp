@@ -0,0 +1,96 @@
+/*******************************************************************************
+ * Copyright (c) 2017, 2017 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+#include "CuTest.h"
+#include "j9.h"
+
+#include "sweepmaps.hpp"
+
+#define VERIFY_MAP_SLOTS 1024
+
+extern J9PortLibrary *sharedPortLibrary;
+
+/**
+ * The block scan must stop on exactly the same slot as the slot at a time scan for every start
+ * position, range length and density, including ranges shorter than a block.
+ */
+void
+Test_Sweep_findMarkedSlotMatchesScalar(CuTest *tc)
+{
+	PORT_ACCESS_FROM_PORT(sharedPortLibrary);
+	UDATA liveRatios[] = { 0, 1, 2, 5, 17, 64, 300 };
+	UDATA *map = (UDATA *)j9mem_allocate_memory(VERIFY_MAP_SLOTS * sizeof(UDATA), OMRMEM_CATEGORY_MM);
+	CuAssertPtrNotNull(tc, map);
+
+	for (UDATA ratio = 0; ratio < sizeof(liveRatios) / sizeof(liveRatios[0]); ratio++) {
+		fillMarkMap(map, VERIFY_MAP_SLOTS, liveRatios[ratio]);
+		for (UDATA start = 0; start < VERIFY_MAP_SLOTS; start++) {
+			for (UDATA length = 0; length <= (MM_MarkMapSweepKernel::SCAN_BLOCK_SLOTS * 3); length++) {
+				UDATA *top = map + OMR_MIN(start + length, (UDATA)VERIFY_MAP_SLOTS);
+				CuAssertPtrEquals(tc,
+					MM_MarkMapSweepKernel::findMarkedSlotScalar(map + start, top),
+					MM_MarkMapSweepKernel::findMarkedSlot(map + start, top));
+			}
+			CuAssertPtrEquals(tc,
+				MM_MarkMapSweepKernel::findMarkedSlotScalar(map + start, map + VERIFY_MAP_SLOTS),
+				MM_MarkMapSweepKernel::findMarkedSlot(map + start, map + VERIFY_MAP_SLOTS));
+		}
+	}
+
+	j9mem_free_memory(map);
+}
+
+/**
+ * Sweeping synthetic mark maps with both scans must find the same free runs.
+ */
+void
+Test_Sweep_sweepMatchesScalar(CuTest *tc)
+{
+	PORT_ACCESS_FROM_PORT(sharedPortLibrary);
+	UDATA liveRatios[] = { 1, 4, 32, 256, 4096, 0 };
+	UDATA *map = (UDATA *)j9mem_allocate_memory(VERIFY_MAP_SLOTS * sizeof(UDATA), OMRMEM_CATEGORY_MM);
+	CuAssertPtrNotNull(tc, map);
+
+	for (UDATA ratio = 0; ratio < sizeof(liveRatios) / sizeof(liveRatios[0]); ratio++) {
+		SweepSummary scalarSummary;
+		SweepSummary blockSummary;
+
+		fillMarkMap(map, VERIFY_MAP_SLOTS, liveRatios[ratio]);
+		sweepMarkMap(MM_MarkMapSweepKernel::findMarkedSlotScalar, map, VERIFY_MAP_SLOTS, &scalarSummary);
+		sweepMarkMap(MM_MarkMapSweepKernel::findMarkedSlot, map, VERIFY_MAP_SLOTS, &blockSummary);
+
+		CuAssertIntEquals(tc, (int)scalarSummary.freeRuns, (int)blockSummary.freeRuns);
+		CuAssertIntEquals(tc, (int)scalarSummary.freeSlots, (int)blockSummary.freeSlots);
+		CuAssertIntEquals(tc, (int)scalarSummary.liveSlots, (int)blockSummary.liveSlots);
+		CuAssertIntEquals(tc, VERIFY_MAP_SLOTS, (int)(blockSummary.freeSlots + blockSummary.liveSlots));
+	}
+
+	j9mem_free_memory(map);
+}
+
+CuSuite
+*GetSweepTestSuite()
+{
+	CuSuite *suite = CuSuiteNew();
+	SUITE_ADD_TEST(suite, Test_Sweep_findMarkedSlotMatchesScalar);
+	SUITE_ADD_TEST(suite, Test_Sweep_sweepMatchesScalar);
+	return suite;
+}
@@ -0,0 +1,82 @@
+/*******************************************************************************
+ * Copyright (c) 2017, 2017 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ *******************************************************************************/
+
+#if !defined(SWEEPMAPS_HPP_)
+#define SWEEPMAPS_HPP_
+
+#include "j9.h"
+
+#include "MarkMapSweepKernel.hpp"
+
+/* result of walking a synthetic mark map the way sweep does */
+typedef struct SweepSummary {
+	UDATA freeRuns; /* number of runs of one or more empty slots */
+	UDATA freeSlots; /* total number of empty slots in those runs */
+	UDATA liveSlots; /* number of slots with at least one mark bit set */
+} SweepSummary;
+
+typedef UDATA *(*FindMarkedSlotFunction)(UDATA *current, UDATA *top);
+
+/**
+ * Fill the map so that on average one slot in liveRatio has mark bits set.
+ * Which slots are live is derived from a hash of the slot index, so the free runs
+ * have irregular lengths but every run produces the same map.
+ * A liveRatio of zero leaves the whole map empty.
+ */
+static void
+fillMarkMap(UDATA *map, UDATA slots, UDATA liveRatio)
+{
+	for (UDATA i = 0; i < slots; i++) {
+		U_32 hash = (U_32)i * 2654435761U;
+		hash ^= hash >> 15;
+		hash *= 0x85EBCA6BU;
+		hash ^= hash >> 13;
+		map[i] = 0;
+		if ((0 != liveRatio) && (0 == ((hash >> 16) % liveRatio))) {
+			/* a single bit at a varying position, the way a lone small object is marked */
+			map[i] = ((UDATA)1) << ((hash >> 8) % (sizeof(UDATA) * 8));
+		}
+	}
+}
+
+static void
+sweepMarkMap(FindMarkedSlotFunction findMarkedSlot, UDATA *map, UDATA slots, SweepSummary *summary)
+{
+	UDATA *current = map;
+	UDATA *top = map + slots;
+
+	summary->freeRuns = 0;
+	summary->freeSlots = 0;
+	summary->liveSlots = 0;
+	while (current < top) {
+		if (0 == *current) {
+			UDATA *freeHead = current;
+			current = findMarkedSlot(current + 1, top);
+			summary->freeRuns += 1;
+			summary->freeSlots += current - freeHead;
+		} else {
+			summary->liveSlots += 1;
+			current += 1;
+		}
+	}
+}
+
+#endif /* SWEEPMAPS_HPP_ */
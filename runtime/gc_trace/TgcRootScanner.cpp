@@ -97,6 +97,8 @@ printRootScannerStats(OMR_VMThread *omrVMThread)
 	MM_TgcExtensions *tgcExtensions = MM_TgcExtensions::getExtensions(currentThread);
 	char timestamp[32];
 	U_64 entityScanTimeTotal[RootScannerEntity_Count] = { 0 };
+	UDATA stackMapCacheHits = 0;
+	UDATA stackMapCacheMisses = 0;
 	J9VMThread *thread;
 	
 	j9str_ftime(timestamp, sizeof(timestamp), "%b %d %H:%M:%S %Y", j9time_current_time_millis());
@@ -129,6 +131,12 @@ printRootScannerStats(OMR_VMThread *omrVMThread)
 			/* Clear root scanner statistics collected for this thread, so data printed during 
 			 * this pass will not be duplicated */ 
 			env->_rootScannerStats.clear();
+
+			/* Interpreted frame stack maps looked up by this thread while scanning stacks */
+			stackMapCacheHits += thread->stackMapCacheHits;
+			stackMapCacheMisses += thread->stackMapCacheMisses;
+			thread->stackMapCacheHits = 0;
+			thread->stackMapCacheMisses = 0;
 		}
 	}
 	
@@ -145,7 +153,12 @@ printRootScannerStats(OMR_VMThread *omrVMThread)
 		}
 	}
 	
-	tgcExtensions->printf("/>\n</scan>\n");
+	tgcExtensions->printf("/>\n");
+
+	if (0 != (stackMapCacheHits + stackMapCacheMisses)) {
+		tgcExtensions->printf("\t<stackmapcache hits=\"%zu\" misses=\"%zu\" />\n", stackMapCacheHits, stackMapCacheMisses);
+	}
+	tgcExtensions->printf("</scan>\n");
 }
 
 static void
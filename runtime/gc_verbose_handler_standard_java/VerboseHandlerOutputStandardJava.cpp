@@ -128,6 +128,18 @@ MM_VerboseHandlerOutputStandardJava::outputOwnableSynchronizerInfo(MM_Environmen
 	}
 }
 
+void
+MM_VerboseHandlerOutputStandardJava::outputJVMTIObjectTagInfo(MM_EnvironmentBase *env, UDATA indent, UDATA objectTagCandidates, UDATA objectTagCleared, U_64 objectTagTime)
+{
+	if (0 != objectTagCandidates) {
+		PORT_ACCESS_FROM_ENVIRONMENT(env);
+		U_64 timeInMicroSeconds = j9time_hires_delta(0, objectTagTime, J9PORT_TIME_DELTA_IN_MICROSECONDS);
+
+		_manager->getWriterChain()->formatAndOutput(env, indent, "<jvmtiObjectTags candidates=\"%zu\" cleared=\"%zu\" timems=\"%llu.%03.3llu\" />",
+				objectTagCandidates, objectTagCleared, timeInMicroSeconds / 1000, timeInMicroSeconds % 1000);
+	}
+}
+
 void
 MM_VerboseHandlerOutputStandardJava::outputReferenceInfo(MM_EnvironmentBase *env, UDATA indent, const char *referenceType, MM_ReferenceStats *referenceStats, UDATA dynamicThreshold, UDATA maxThreshold)
 {
@@ -159,6 +171,8 @@ MM_VerboseHandlerOutputStandardJava::handleMarkEndInternal(MM_EnvironmentBase* e
 
 	outputStringConstantInfo(env, 1, markJavaStats->_stringConstantsCandidates, markJavaStats->_stringConstantsCleared);
 
+	outputJVMTIObjectTagInfo(env, 1, markJavaStats->_jvmtiObjectTagCandidates, markJavaStats->_jvmtiObjectTagCleared, markJavaStats->_jvmtiObjectTagTime);
+
 	if (workPacketStats->getSTWWorkStackOverflowOccured()) {
 		_manager->getWriterChain()->formatAndOutput(env, 1, "<warning details=\"work packet overflow\" count=\"%zu\" packetcount=\"%zu\" />",
 				workPacketStats->getSTWWorkStackOverflowCount(), workPacketStats->getSTWWorkpacketCountAtOverflow());
@@ -220,6 +234,8 @@ MM_VerboseHandlerOutputStandardJava::handleScavengeEndInternal(MM_EnvironmentBas
 		outputReferenceInfo(env, 1, "soft", &scavengerJavaStats->_softReferenceStats, extensions->getDynamicMaxSoftReferenceAge(), extensions->getMaxSoftReferenceAge());
 		outputReferenceInfo(env, 1, "weak", &scavengerJavaStats->_weakReferenceStats, 0, 0);
 		outputReferenceInfo(env, 1, "phantom", &scavengerJavaStats->_phantomReferenceStats, 0, 0);
+
+		outputJVMTIObjectTagInfo(env, 1, scavengerJavaStats->_jvmtiObjectTagCandidates, scavengerJavaStats->_jvmtiObjectTagCleared, scavengerJavaStats->_jvmtiObjectTagTime);
 	}
 }
 #endif /*defined(J9VM_GC_MODRON_SCAVENGER) */
@@ -54,6 +54,16 @@ private:
 	 */
 	void outputOwnableSynchronizerInfo(MM_EnvironmentBase *env, UDATA indent, UDATA ownableSynchronizerCandidates, UDATA ownableSynchronizerCleared);
 
+	/**
+	 * Output JVMTI object tag table processing summary.
+	 * @param env GC thread used for output.
+	 * @param indent base level of indentation for the summary.
+	 * @param objectTagCandidates number of tagged objects encountered in the object tag tables.
+	 * @param objectTagCleared number of tags cleared because their object died.
+	 * @param objectTagTime hires clock time the slowest GC thread spent on the object tag tables.
+	 */
+	void outputJVMTIObjectTagInfo(MM_EnvironmentBase *env, UDATA indent, UDATA objectTagCandidates, UDATA objectTagCleared, U_64 objectTagTime);
+
 	/**
 	 * Output reference processing summary.
 	 * @param env GC thread used for output.
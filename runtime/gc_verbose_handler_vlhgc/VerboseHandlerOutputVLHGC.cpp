@@ -280,6 +280,18 @@ MM_VerboseHandlerOutputVLHGC::outputOwnableSynchronizerInfo(MM_EnvironmentBase *
 	}
 }
 
+void
+MM_VerboseHandlerOutputVLHGC::outputJVMTIObjectTagInfo(MM_EnvironmentBase *env, UDATA indent, UDATA objectTagCandidates, UDATA objectTagCleared, U_64 objectTagTime)
+{
+	if (0 != objectTagCandidates) {
+		PORT_ACCESS_FROM_ENVIRONMENT(env);
+		U_64 timeInMicroSeconds = j9time_hires_delta(0, objectTagTime, J9PORT_TIME_DELTA_IN_MICROSECONDS);
+
+		_manager->getWriterChain()->formatAndOutput(env, indent, "<jvmtiObjectTags candidates=\"%zu\" cleared=\"%zu\" timems=\"%llu.%03.3llu\" />",
+				objectTagCandidates, objectTagCleared, timeInMicroSeconds / 1000, timeInMicroSeconds % 1000);
+	}
+}
+
 void
 MM_VerboseHandlerOutputVLHGC::outputReferenceInfo(MM_EnvironmentBase *env, UDATA indent, const char *referenceType, MM_ReferenceStats *referenceStats, UDATA dynamicThreshold, UDATA maxThreshold)
 {
@@ -398,6 +410,10 @@ MM_VerboseHandlerOutputVLHGC::handleCopyForwardEnd(J9HookInterface** hook, UDATA
 				copyForwardStats->_copyObjectsEden, copyForwardStats->_copyBytesEden, copyForwardStats->_copyDiscardBytesEden);
 	writer->formatAndOutput(env, 1, "<memory-copied type=\"other\" objects=\"%zu\" bytes=\"%zu\" bytesdiscarded=\"%zu\" />",
 				copyForwardStats->_copyObjectsNonEden, copyForwardStats->_copyBytesNonEden, copyForwardStats->_copyDiscardBytesNonEden);
+	if (extensions->_numaManager.isPhysicalNUMASupported()) {
+		writer->formatAndOutput(env, 1, "<memory-copied type=\"crossnode\" objects=\"%zu\" bytes=\"%zu\" />",
+					copyForwardStats->_copyObjectsCrossNode, copyForwardStats->_copyBytesCrossNode);
+	}
 	writer->formatAndOutput(env, 1, "<memory-cardclean objects=\"%zu\" bytes=\"%zu\" />",
 				copyForwardStats->_objectsCardClean, copyForwardStats->_bytesCardClean);
 	if(copyForwardStats->_aborted) {
@@ -418,6 +434,9 @@ MM_VerboseHandlerOutputVLHGC::handleCopyForwardEnd(J9HookInterface** hook, UDATA
 
 	outputStringConstantInfo(env, 1, copyForwardStats->_stringConstantsCandidates, copyForwardStats->_stringConstantsCleared);
 
+	/* copy forward only forwards tags, those of dead objects are cleared by the next mark */
+	outputJVMTIObjectTagInfo(env, 1, copyForwardStats->_jvmtiObjectTagCandidates, 0, copyForwardStats->_jvmtiObjectTagTime);
+
 	if(0 != copyForwardStats->_heapExpandedCount) {
 		U_64 expansionMicros = j9time_hires_delta(0, copyForwardStats->_heapExpandedTime, J9PORT_TIME_DELTA_IN_MICROSECONDS);
 		outputCollectorHeapResizeInfo(env, 1, HEAP_EXPAND, copyForwardStats->_heapExpandedBytes, copyForwardStats->_heapExpandedCount, MEMORY_TYPE_OLD, SATISFY_COLLECTOR, expansionMicros);
@@ -579,6 +598,8 @@ MM_VerboseHandlerOutputVLHGC::outputMarkSummary(MM_EnvironmentBase *env, const c
 
 	outputStringConstantInfo(env, 1, markStats->_stringConstantsCandidates, markStats->_stringConstantsCleared);
 
+	outputJVMTIObjectTagInfo(env, 1, markStats->_jvmtiObjectTagCandidates, markStats->_jvmtiObjectTagCleared, markStats->_jvmtiObjectTagTime);
+
 	switch (env->_cycleState->_reasonForMarkCompactPGC) {
 	case MM_CycleState::reason_not_exceptional:
 		/* nothing to report */
@@ -65,6 +65,7 @@
 #include "FinalizableReferenceBuffer.hpp"
 #include "FinalizeListManager.hpp"
 #include "GlobalAllocationManager.hpp"
+#include "GlobalAllocationManagerTarok.hpp"
 #include "Heap.hpp"
 #include "HeapMapIterator.hpp"
 #include "HeapMapWordIterator.hpp"
@@ -321,6 +322,8 @@ MM_CopyForwardScheme::MM_CopyForwardScheme(MM_EnvironmentVLHGC *env, MM_HeapRegi
 	, _tracingEnabled(false)
 	, _cacheTracingEnabled(false)
 	, _commonContext(NULL)
+	, _numaNodeContexts(NULL)
+	, _numaAffinityEnabled(false)
 	, _compactGroupBlock(NULL)
 	, _arraySplitSize(0)
 	, _regionSublistContentionThreshold(0)
@@ -380,6 +383,13 @@ MM_CopyForwardScheme::initialize(MM_EnvironmentVLHGC *env)
 	if(omrthread_monitor_init_with_name(&_scanCacheMonitor, 0, "MM_CopyForwardScheme::cache")) {
 		return false;
 	}
+
+	UDATA nodeContextsSizeInBytes = sizeof(MM_AllocationContextTarok *) * _scanCacheListSize;
+	_numaNodeContexts = (MM_AllocationContextTarok **)env->getForge()->allocate(nodeContextsSizeInBytes, MM_AllocationCategory::FIXED, J9_GET_CALLSITE());
+	if (NULL == _numaNodeContexts) {
+		return false;
+	}
+	memset((void*)_numaNodeContexts, 0x0, nodeContextsSizeInBytes);
 	
 	/* Get the estimated cache count required.  The cachesPerThread argument is used to ensure there are at least enough active
 	 * caches for all working threads (threadCount * cachesPerThread)
@@ -480,6 +490,11 @@ MM_CopyForwardScheme::tearDown(MM_EnvironmentVLHGC *env)
 		_cacheScanLists = NULL;
 	}
 
+	if (NULL != _numaNodeContexts) {
+		env->getForge()->free(_numaNodeContexts);
+		_numaNodeContexts = NULL;
+	}
+
 	if (NULL != _scanCacheMonitor) {
 		omrthread_monitor_destroy(_scanCacheMonitor);
 		_scanCacheMonitor = NULL;
@@ -503,12 +518,19 @@ MM_CopyForwardScheme::tearDown(MM_EnvironmentVLHGC *env)
 }
 
 MM_AllocationContextTarok *
-MM_CopyForwardScheme::getPreferredAllocationContext(MM_AllocationContextTarok *suggestedContext, J9Object *objectPtr)
+MM_CopyForwardScheme::getPreferredAllocationContext(MM_EnvironmentVLHGC *env, MM_AllocationContextTarok *suggestedContext, J9Object *objectPtr)
 {
 	MM_AllocationContextTarok *preferredContext = suggestedContext;
 
 	if (preferredContext == _commonContext) {
-		preferredContext = getContextForHeapAddress(objectPtr);
+		preferredContext = NULL;
+		if (_numaAffinityEnabled) {
+			/* copy into the node this GC thread is bound to so that the survivor is local to the thread which will scan it */
+			preferredContext = _numaNodeContexts[env->getNumaAffinity()];
+		}
+		if (NULL == preferredContext) {
+			preferredContext = getContextForHeapAddress(objectPtr);
+		}
 	} /* no code beyond this point without modifying else statement below */
 	return preferredContext;
 }
@@ -1580,6 +1602,23 @@ MM_CopyForwardScheme::masterSetupForCopyForward(MM_EnvironmentVLHGC *env)
 
 	/* Context 0 is currently our "common destination context" */
 	_commonContext = (MM_AllocationContextTarok *)_extensions->globalAllocationManager->getAllocationContextByIndex(0);
+
+	/* NUMA affinity only makes sense if GC threads are actually bound to nodes */
+	_numaAffinityEnabled = _extensions->tarokEnableCopyForwardNumaAffinity && _extensions->_numaManager.isPhysicalNUMASupported();
+	if (_numaAffinityEnabled) {
+		MM_GlobalAllocationManagerTarok *allocationManager = (MM_GlobalAllocationManagerTarok *)_extensions->globalAllocationManager;
+		UDATA contextCount = allocationManager->getManagedAllocationContextCount();
+		memset((void*)_numaNodeContexts, 0x0, sizeof(MM_AllocationContextTarok *) * _scanCacheListSize);
+		for (UDATA i = 0; i < contextCount; i++) {
+			MM_AllocationContextTarok *context = allocationManager->getAllocationContextByIndex(i);
+			UDATA numaNode = context->getNumaNode();
+			/* node 0 means "no affinity" so leave it unmapped to preserve the default behaviour for unbound threads */
+			if ((0 != numaNode) && (context != _commonContext)) {
+				Assert_MM_true(numaNode < _scanCacheListSize);
+				_numaNodeContexts[numaNode] = context;
+			}
+		}
+	}
 	
 	/* We don't want to split too aggressively so take the base2 log of our thread count as our current contention trigger.
 	 * Note that this number could probably be improved upon but log2 "seemed" to make sense for contention measurement and
@@ -2147,7 +2186,7 @@ MM_CopyForwardScheme::copy(MM_EnvironmentVLHGC *env, MM_AllocationContextTarok *
 		}
 #endif /* J9VM_INTERP_NATIVE_SUPPORT */
 
-		reservingContext = getPreferredAllocationContext(reservingContext, object);
+		reservingContext = getPreferredAllocationContext(env, reservingContext, object);
 
 		copyCache = reserveMemoryForCopy(env, object, reservingContext, objectReserveSizeInBytes);
 
@@ -2244,6 +2283,10 @@ MM_CopyForwardScheme::copy(MM_EnvironmentVLHGC *env, MM_AllocationContextTarok *
 				}
 				MM_HeapRegionDescriptorVLHGC * sourceRegion = (MM_HeapRegionDescriptorVLHGC *)_regionManager->tableDescriptorForAddress(object);
 				UDATA sourceCompactGroup = MM_CompactGroupManager::getCompactGroupNumber(env, sourceRegion);
+				if (sourceRegion->getNumaNode() != _regionManager->tableDescriptorForAddress(destinationObjectPtr)->getNumaNode()) {
+					env->_copyForwardStats._copyObjectsCrossNode += 1;
+					env->_copyForwardStats._copyBytesCrossNode += objectCopySizeInBytes;
+				}
 				if (sourceRegion->isEden()) {
 					env->_copyForwardCompactGroups[sourceCompactGroup]._edenStats._liveObjects += 1;
 					env->_copyForwardCompactGroups[sourceCompactGroup]._edenStats._liveBytes += objectCopySizeInBytes;
@@ -4046,12 +4089,18 @@ private:
 	virtual void doJVMTIObjectTagSlot(J9Object **slotPtr, GC_JVMTIObjectTagTableIterator *objectTagTableIterator)
 	{
 		J9Object *objectPtr = *slotPtr;
+		MM_EnvironmentVLHGC::getEnvironment(_env)->_copyForwardStats._jvmtiObjectTagCandidates += 1;
 		if(!_copyForwardScheme->isLiveObject(objectPtr)) {
 			Assert_MM_true(_copyForwardScheme->isObjectInEvacuateMemory(objectPtr));
 			MM_ScavengerForwardedHeader forwardedHeader(objectPtr);
 			*slotPtr = forwardedHeader.getForwardedObject();
 		}
 	}
+
+	virtual void reportJVMTIObjectTagTablesScanTime(U_64 scanTime)
+	{
+		MM_EnvironmentVLHGC::getEnvironment(_env)->_copyForwardStats._jvmtiObjectTagTime += scanTime;
+	}
 #endif /* J9VM_OPT_JVMTI */
 
 #if defined(J9VM_GC_FINALIZATION)
@@ -142,6 +142,8 @@ private:
 	bool _tracingEnabled;  /**< Temporary variable to enable tracing of activity */
 	bool _cacheTracingEnabled;  /**< Temporary variable to enable tracing of activity */
 	MM_AllocationContextTarok *_commonContext;	/**< The common context is used as an opaque token to represent cases where we don't want to relocate objects during NUMA-aware copy-forward since relocating to the common context is currently disabled */
+	MM_AllocationContextTarok **_numaNodeContexts;	/**< An array of _scanCacheListSize elements mapping each NUMA node to the allocation context bound to it (NULL for nodes with no context) */
+	bool _numaAffinityEnabled;	/**< True if objects which would otherwise be copied into their owning context should instead be copied into the context of the copying thread's NUMA node */
 	MM_CopyForwardCompactGroup *_compactGroupBlock; /**< A block of MM_CopyForwardCompactGroup structs which is subdivided among the GC threads */ 
 	UDATA _arraySplitSize; /**< The number of elements to be scanned in each array chunk (this determines the degree of parallelization) */
 
@@ -1022,12 +1024,13 @@ protected:
 	/**
 	 * Checks whether the suggestedContext passed in is a preferred allocation context for
 	 * object relocation. If so the same context is returned if not the object's original context
-	 * is returned.
+	 * is returned (or, when NUMA affinity is enabled, the context bound to the copying thread's node).
+	 * @param[in] env The GC thread performing the copy
 	 * @param[in] suggestedContext The allocation context we intended to copy the object into
 	 * @param[in] objectPtr A pointer to the object being copied
 	 * @return The reservingContext or the object's owning context if the suggestedContext is not a preferred object relocation context
 	 */
-	MMINLINE MM_AllocationContextTarok *getPreferredAllocationContext(MM_AllocationContextTarok *suggestedContext, J9Object *objectPtr);
+	MMINLINE MM_AllocationContextTarok *getPreferredAllocationContext(MM_EnvironmentVLHGC *env, MM_AllocationContextTarok *suggestedContext, J9Object *objectPtr);
 
 public:
 
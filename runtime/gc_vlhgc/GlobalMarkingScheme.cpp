@@ -1286,10 +1286,16 @@ private:
 
 #if defined(J9VM_OPT_JVMTI)
 	virtual void doJVMTIObjectTagSlot(J9Object **slotPtr, GC_JVMTIObjectTagTableIterator *objectTagTableIterator) {
+		MM_EnvironmentVLHGC::getEnvironment(_env)->_markVLHGCStats._jvmtiObjectTagCandidates += 1;
 		if(!_markingScheme->isMarked(*slotPtr)) {
+			MM_EnvironmentVLHGC::getEnvironment(_env)->_markVLHGCStats._jvmtiObjectTagCleared += 1;
 			objectTagTableIterator->removeSlot();
 		}
 	}
+
+	virtual void reportJVMTIObjectTagTablesScanTime(U_64 scanTime) {
+		MM_EnvironmentVLHGC::getEnvironment(_env)->_markVLHGCStats._jvmtiObjectTagTime += scanTime;
+	}
 #endif /* defined(J9VM_OPT_JVMTI) */
 
 public:
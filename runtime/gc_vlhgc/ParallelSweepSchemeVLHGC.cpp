@@ -50,6 +50,7 @@
 #include "HeapRegionIteratorVLHGC.hpp"
 #include "HeapRegionManager.hpp"
 #include "MarkMap.hpp"
+#include "MarkMapSweepKernel.hpp"
 #include "Math.hpp"
 #include "MemoryPool.hpp"
 #include "MemoryPoolBumpPointer.hpp"
@@ -394,14 +395,7 @@ MM_ParallelSweepSchemeVLHGC::sweepMarkMapBody(
 		markMapFreeHead = markMapCurrent;
 		heapSlotFreeHead = heapSlotFreeCurrent;
 
-		markMapCurrent += 1;
-
-		while(markMapCurrent < markMapChunkTop) {
-			if(*markMapCurrent != J9MODRON_OBM_SLOT_EMPTY) {
-				break;
-			}
-			markMapCurrent += 1;
-		}
+		markMapCurrent = MM_MarkMapSweepKernel::findMarkedSlot(markMapCurrent + 1, markMapChunkTop);
 
 		/* Find the number of slots we've walked
 		 * (pointer math makes this the number of slots)
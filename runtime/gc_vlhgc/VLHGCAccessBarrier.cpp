@@ -221,6 +221,26 @@ MM_VLHGCAccessBarrier::forwardReferenceArrayCopyIndex(J9VMThread *vmThread, J9In
 	
 	return retValue;
 }
+
+/**
+ * Type checked forward copy which dirties the destination card once rather than once per slot.
+ * @return ARRAY_COPY_SUCCESSFUL if copy was successful, ARRAY_COPY_NOT_DONE no copy is done,
+ * otherwise the index of the element which could not be stored
+ */
+I_32
+MM_VLHGCAccessBarrier::forwardReferenceArrayCopyWithCheckIndex(J9VMThread *vmThread, J9IndexableObject *srcObject, J9IndexableObject *destObject, I_32 srcIndex, I_32 destIndex, I_32 lengthInSlots)
+{
+	MM_EnvironmentVLHGC *env = MM_EnvironmentVLHGC::getEnvironment(vmThread);
+	I_32 retValue = ARRAY_COPY_NOT_DONE;
+
+	if (_extensions->indexableObjectModel.isInlineContiguousArraylet(destObject) && _extensions->indexableObjectModel.isInlineContiguousArraylet(srcObject)) {
+		retValue = doCopyContiguousForwardWithCheck(vmThread, srcObject, destObject, srcIndex, destIndex, lengthInSlots);
+		/* a failed check still leaves the slots before it copied */
+		_extensions->cardTable->dirtyCard(env, (J9Object *)destObject);
+	}
+
+	return retValue;
+}
 #endif /* J9VM_GC_ARRAYLETS */
 
 /**
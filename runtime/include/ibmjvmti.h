@@ -204,7 +204,8 @@ enum {
 
 enum {
 	COM_IBM_JLM_DUMP_FORMAT_OBJECT_ID = 0,
-	COM_IBM_JLM_DUMP_FORMAT_TAGS      = 1
+	COM_IBM_JLM_DUMP_FORMAT_TAGS      = 1,
+	COM_IBM_JLM_DUMP_FORMAT_SPIN_RATE = 2	/** As COM_IBM_JLM_DUMP_FORMAT_TAGS, followed by the 4 byte adaptive spin success rate (out of 1024). JVMTI_ERROR_NOT_AVAILABLE unless -Xthr:adaptiveTryEnterSpinning is specified */
 };
 
 
@@ -159,6 +159,20 @@ typedef struct J9ZipDirEntry {
 #define J9ZIPDIRENTRY_FILELIST(base) WSRP_GET((base)->fileList, struct J9ZipFileRecord*)
 #define J9ZIPDIRENTRY_DIRLIST(base) WSRP_GET((base)->dirList, struct J9ZipDirEntry*)
 
+typedef struct J9ZipFileIndexSlot {
+    J9WSRP dirEntry;
+    J9WSRP fileEntry;
+} J9ZipFileIndexSlot;
+
+#define J9ZIPFILEINDEXSLOT_DIRENTRY(base) WSRP_GET((base)->dirEntry, struct J9ZipDirEntry*)
+#define J9ZIPFILEINDEXSLOT_FILEENTRY(base) WSRP_GET((base)->fileEntry, struct J9ZipFileEntry*)
+
+typedef struct J9ZipFileIndex {
+    UDATA size;
+    UDATA count;
+    struct J9ZipFileIndexSlot slots[1];
+} J9ZipFileIndex;
+
 typedef struct J9ZipCacheEntry {
     J9WSRP zipFileName;
     IDATA zipFileSize;
@@ -166,12 +180,14 @@ typedef struct J9ZipCacheEntry {
     IDATA startCentralDir;
     J9WSRP currentChunk;
     J9WSRP chunkActiveDir;
+    J9WSRP fileIndex;
     struct J9ZipDirEntry root;
 } J9ZipCacheEntry;
 
 #define J9ZIPCACHEENTRY_ZIPFILENAME(base) WSRP_GET((base)->zipFileName, U_8*)
 #define J9ZIPCACHEENTRY_CURRENTCHUNK(base) WSRP_GET((base)->currentChunk, struct J9ZipChunkHeader*)
 #define J9ZIPCACHEENTRY_CHUNKACTIVEDIR(base) WSRP_GET((base)->chunkActiveDir, struct J9ZipDirEntry*)
+#define J9ZIPCACHEENTRY_FILEINDEX(base) WSRP_GET((base)->fileIndex, struct J9ZipFileIndex*)
 #define J9ZIPCACHEENTRY_NEXT(base) WSRP_GET((&((base)->root))->next, struct J9ZipDirEntry*)
 #define J9ZIPCACHEENTRY_FILELIST(base) WSRP_GET((&((base)->root))->fileList, struct J9ZipFileRecord*)
 #define J9ZIPCACHEENTRY_DIRLIST(base) WSRP_GET((&((base)->root))->dirList, struct J9ZipDirEntry*)
@@ -52,7 +52,7 @@ defineClassCommon(JNIEnv *env, jobject classLoaderObject,
 	J9ROMClass *loadedClass = NULL;
 	U_8 *tempClassBytes = NULL;
 	I_32 tempLength = 0;
-	J9TranslationLocalBuffer localBuffer = {J9_CP_INDEX_NONE, LOAD_LOCATION_UNKNOWN, NULL};
+	J9TranslationLocalBuffer localBuffer = {J9_CP_INDEX_NONE, LOAD_LOCATION_UNKNOWN, NULL, NULL};
 
 	if (vm->dynamicLoadBuffers == NULL) {
 		throwNewInternalError(env, "Dynamic loader is unavailable");
@@ -125,6 +125,15 @@ defineClassCommon(JNIEnv *env, jobject classLoaderObject,
 		}
 	}
 
+	/* Parse and verify the bytes before taking the class table mutex, so that loaders defining
+	 * classes on several threads only serialize on building the ROMClass.
+	 */
+	if (isContiguousClassBytes) {
+		classBytes = (U_8 *) TMP_J9JAVACONTIGUOUSARRAYOFBYTE_EA(currentThread, *(J9IndexableObject **)classRep, offset);
+	}
+	localBuffer.preparsedClassFile = dynFuncs->preparseClassFileFunction(currentThread, classBytes, (UDATA) length, classLoader,
+			options | J9_FINDCLASS_FLAG_THROW_ON_FAIL | J9_FINDCLASS_FLAG_NO_CHECK_FOR_EXISTING_CLASS);
+
 retry:
 
 	omrthread_monitor_enter(vm->classTableMutex);
@@ -197,6 +206,9 @@ retry:
 	
 	if (currentThread->privateFlags & J9_PRIVATE_FLAGS_CLOAD_NO_MEM) {
 		if (!retried) {
+			/* the GC may move the class bytes, so parse them again on the retry */
+			dynFuncs->freePreparsedClassFileFunction(vm, localBuffer.preparsedClassFile);
+			localBuffer.preparsedClassFile = NULL;
 			/*Trc_VM_internalFindClass_gcAndRetry(vmThread);*/
 			currentThread->javaVM->memoryManagerFunctions->j9gc_modron_global_collect_with_overrides(currentThread, J9MMCONSTANT_EXPLICIT_GC_NATIVE_OUT_OF_MEMORY);
 			retried = TRUE;
@@ -215,6 +227,7 @@ done:
 
 	vmFuncs->internalReleaseVMAccess(currentThread);
 
+	dynFuncs->freePreparsedClassFileFunction(vm, localBuffer.preparsedClassFile);
 	j9mem_free_memory(utf8Name);
 
 	if (!isContiguousClassBytes) {
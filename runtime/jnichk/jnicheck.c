@@ -1170,7 +1170,13 @@ jniIsGlobalRef(JNIEnv* env, jobject reference)
 	omrthread_monitor_enter(vm->jniFrameMutex);
 #endif
 	/* walk the JNIGlobalReferences pool */
+#ifdef J9VM_THR_PREEMPTIVE
+	omrthread_monitor_enter(vm->jniGlobalReferencesMutex);
+#endif
 	rc = pool_includesElement(vm->jniGlobalReferences, reference);
+#ifdef J9VM_THR_PREEMPTIVE
+	omrthread_monitor_exit(vm->jniGlobalReferencesMutex);
+#endif
 
 	if (!rc) {
 		j9object_t heapclass;
@@ -1304,12 +1310,12 @@ static UDATA jniIsWeakGlobalRef(JNIEnv* env, jobject reference) {
 	}
 
 #ifdef J9VM_THR_PREEMPTIVE
-	omrthread_monitor_enter(vm->jniFrameMutex);
+	omrthread_monitor_enter(vm->jniGlobalReferencesMutex);
 #endif
 	/* walk the JNIWeakGlobalReferences pool */
 	rc = pool_includesElement(vm->jniWeakGlobalReferences, reference);
 #ifdef J9VM_THR_PREEMPTIVE
-	omrthread_monitor_exit(vm->jniFrameMutex);
+	omrthread_monitor_exit(vm->jniGlobalReferencesMutex);
 #endif
 
 	if (enteredWithoutVMAccess) {
@@ -925,6 +925,8 @@
 
 						<!-- executables, find using: find . -name module.xml | xargs grep executable -->
 						<include name="algotest${r"${exe.suffix}"}/" />
+						<include name="jitlookperf${r"${exe.suffix}"}/" />
+						<include name="crc32perf${r"${exe.suffix}"}/" />
 						<include name="dyntest${r"${exe.suffix}"}/" />
 						<include name="bcvunit${r"${exe.suffix}"}/" />
 						<include name="ctest${r"${exe.suffix}"}/" />
@@ -958,6 +960,8 @@
 						<include name="thrextendedtest${r"${exe.suffix}"}/" />
 						<include name="servicetest${r"${exe.suffix}"}/" />
 						<include name="gc_rwlocktest${r"${exe.suffix}"}/" />
+						<include name="gc_sweeptest${r"${exe.suffix}"}/" />
+						<include name="gc_sweepperf${r"${exe.suffix}"}/" />
 						<include name="testjep178_static${r"${exe.suffix}"}/" />
 						<include name="testjep178_dynamic${r"${exe.suffix}"}/" />
 					</fileset>
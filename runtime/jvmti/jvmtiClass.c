@@ -1240,6 +1240,9 @@ restoreBreakpointsInClasses(J9VMThread * currentThread, J9HashTable * classPairs
 	J9JVMTIClassPair * classPair;
 	J9JVMTIData * jvmtiData = J9JVMTI_DATA_FROM_VM(currentThread->javaVM);
 	
+	/* Decompile the compiled frames for all the restored breakpoints with a single walk of each stack */
+	startCodeBreakpointBatch(currentThread);
+
 	classPair = hashTableStartDo(classPairs, &hashTableState);
 	while (classPair != NULL) {
 		J9Class * originalRAMClass = classPair->originalRAMClass;
@@ -1262,6 +1265,8 @@ restoreBreakpointsInClasses(J9VMThread * currentThread, J9HashTable * classPairs
 		}
 		classPair = hashTableNextDo(&hashTableState);
 	}
+
+	endCodeBreakpointBatch(currentThread);
 }
 
 
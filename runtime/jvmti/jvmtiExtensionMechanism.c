@@ -3327,11 +3327,17 @@ jvmtiJlmDumpStats(jvmtiEnv* env, void ** dump_info, jint dump_format, ...)
 	ENSURE_PHASE_LIVE(env);
 	ENSURE_NON_NULL(dump_info);
 
-    if ( (dump_format < COM_IBM_JLM_DUMP_FORMAT_OBJECT_ID) || (dump_format > COM_IBM_JLM_DUMP_FORMAT_TAGS)) {
+    if ( (dump_format < COM_IBM_JLM_DUMP_FORMAT_OBJECT_ID) || (dump_format > COM_IBM_JLM_DUMP_FORMAT_SPIN_RATE)) {
         rc = JVMTI_ERROR_ILLEGAL_ARGUMENT;
         goto done;
     }
 
+	/* the spin success rate is only maintained with -Xthr:adaptiveTryEnterSpinning */
+	if ((COM_IBM_JLM_DUMP_FORMAT_SPIN_RATE == dump_format) && (0 == JAVAVM_FROM_ENV(env)->thrAdaptiveTryEnterSpinning)) {
+		rc = JVMTI_ERROR_NOT_AVAILABLE;
+		goto done;
+	}
+
 #if defined(OMR_THR_JLM)
 	rc = jvmtiJlmDumpHelper(env, dump_info, dump_format);		
 #endif /* OMR_THR_JLM */
@@ -1391,8 +1391,43 @@ jvmtiError
 installAgentBreakpoint(J9VMThread * currentThread, J9JVMTIAgentBreakpoint * agentBreakpoint)
 {
 	J9Method * ramMethod = ((J9JNIMethodID *) agentBreakpoint->method)->method;
+	jvmtiError rc;
 
-	return setGlobalBreakpoint(currentThread, ramMethod, agentBreakpoint->location, &(agentBreakpoint->globalBreakpoint));
+	/* The breakpoint may be set in several equivalent methods of redefined classes - find their compiled frames in one pass */
+
+	startCodeBreakpointBatch(currentThread);
+	rc = setGlobalBreakpoint(currentThread, ramMethod, agentBreakpoint->location, &(agentBreakpoint->globalBreakpoint));
+	endCodeBreakpointBatch(currentThread);
+
+	return rc;
+}
+
+
+
+void
+startCodeBreakpointBatch(J9VMThread * currentThread)
+{
+#ifdef J9VM_JIT_FULL_SPEED_DEBUG
+	J9JavaVM * vm = currentThread->javaVM;
+
+	if (J9_FSD_ENABLED(vm)) {
+		vm->jitConfig->jitCodeBreakpointBatchStarted(currentThread);
+	}
+#endif
+}
+
+
+
+void
+endCodeBreakpointBatch(J9VMThread * currentThread)
+{
+#ifdef J9VM_JIT_FULL_SPEED_DEBUG
+	J9JavaVM * vm = currentThread->javaVM;
+
+	if (J9_FSD_ENABLED(vm)) {
+		vm->jitConfig->jitCodeBreakpointBatchEnded(currentThread);
+	}
+#endif
 }
 
 
@@ -1147,6 +1147,24 @@ jvmtiError
 installAgentBreakpoint(J9VMThread * currentThread, J9JVMTIAgentBreakpoint * agentBreakpoint);
 
 
+/**
+* @brief Start deferring the JIT stack walks for code breakpoints added under the current exclusive VM access
+* @param currentThread
+* @return void
+*/
+void
+startCodeBreakpointBatch(J9VMThread * currentThread);
+
+
+/**
+* @brief Walk the stacks once for all code breakpoints added since the matching startCodeBreakpointBatch
+* @param currentThread
+* @return void
+*/
+void
+endCodeBreakpointBatch(J9VMThread * currentThread);
+
+
 /**
 * @brief
 * @param pUtfData
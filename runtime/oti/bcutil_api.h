@@ -226,6 +226,31 @@ UDATA
 internalLoadROMClass(J9VMThread *vmThread, J9LoadROMClassData *loadData, J9TranslationLocalBuffer *localBuffer);
 
 
+/**
+* @brief Parse and statically verify class file bytes before the class table mutex is taken to define them.
+* The result is passed to internalDefineClass() in localBuffer->preparsedClassFile and is only used if the
+* dynamic loader would have parsed the same bytes with the same flags, so callers need not check this.
+* @param vmThread
+* @param classData
+* @param classDataLength
+* @param classLoader
+* @param options the options which will be passed to internalDefineClass()
+* @return J9PreparsedClassFile*, or NULL if the bytes were not pre-parsed (errors are reported when the class is defined)
+*/
+J9PreparsedClassFile *
+j9bcutil_preparseClassFile(J9VMThread *vmThread, U_8 *classData, UDATA classDataLength, J9ClassLoader *classLoader, UDATA options);
+
+
+/**
+* @brief Free a class file returned by j9bcutil_preparseClassFile()
+* @param vm
+* @param preparsedClassFile may be NULL
+* @return void
+*/
+void
+j9bcutil_freePreparsedClassFile(J9JavaVM *vm, J9PreparsedClassFile *preparsedClassFile);
+
+
 #endif /* J9VM_OPT_DYNAMIC_LOAD_SUPPORT */ /* End File Level Build Flags */
 
 
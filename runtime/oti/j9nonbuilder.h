@@ -37,6 +37,8 @@
 
 #define J9VM_DLT_HISTORY_SIZE  16
 #define J9VM_OBJECT_MONITOR_CACHE_SIZE  32
+#define J9VM_MONITOR_TABLE_LOOKUP_CACHE_SIZE  1024
+#define J9VM_MONITOR_TABLE_LOOKUP_CACHE_PROBES  4
 #define J9VM_ASYNC_MAX_HANDLERS 32
 
 /* @ddr_namespace: map_to_type=J9JITDataCacheConstants */
@@ -494,6 +496,7 @@ typedef struct J9JITBreakpointedMethod {
 	UDATA count;
 	struct J9JITBreakpointedMethod* link;
 	UDATA hasBeenTranslated;
+	UDATA stackScanPending;
 } J9JITBreakpointedMethod;
 
 typedef struct J9JITFrame {
@@ -1166,6 +1169,12 @@ typedef struct J9SharedCacheInfo {
 	UDATA softMaxBytes;
 } J9SharedCacheInfo;
 
+/* Reader counts kept in cache lines of their own in J9SharedCacheHeader.readerSlots, so JVMs registering reads do not contend on readerCount.
+ * The area has room for one extra slot, as the slots are aligned to J9SH_READER_SLOT_BYTES from the start of the area.
+ */
+#define J9SH_READER_SLOT_COUNT 8
+#define J9SH_READER_SLOT_BYTES 64
+
 typedef struct J9SharedCacheHeader {
 	U_32 totalBytes;
 	U_32 readWriteBytes;
@@ -1222,6 +1231,7 @@ typedef struct J9SharedCacheHeader {
 	UDATA unused8;
 	UDATA unused9;
 	UDATA unused10;
+	U_8 readerSlots[(J9SH_READER_SLOT_COUNT + 1) * J9SH_READER_SLOT_BYTES];
 } J9SharedCacheHeader;
 
 #define J9SHAREDCACHEHEADER_UPDATECOUNTPTR(base) WSRP_GET((base)->updateCountPtr, UDATA*)
@@ -1526,8 +1536,15 @@ typedef struct J9ObjectMonitor {
 	j9objectmonitor_t alternateLockword;
 #endif /* J9VM_THR_LOCK_NURSERY */
 	U_32 hash;
+	U_32 spinSuccessRate;
 } J9ObjectMonitor;
 
+/* spinSuccessRate is a decaying fraction of J9_OBJECT_MONITOR_SPIN_RATE_ONE */
+#define J9_OBJECT_MONITOR_SPIN_RATE_ONE  1024
+#define J9_OBJECT_MONITOR_SPIN_RATE_SHIFT  10
+#define J9_OBJECT_MONITOR_SPIN_RATE_DECAY_SHIFT  3
+#define J9_OBJECT_MONITOR_SPIN_RATE_MIN  64
+
 typedef struct J9ClassWalkState {
 	struct J9JavaVM* vm;
 	struct J9MemorySegment* nextSegment;
@@ -1778,10 +1795,19 @@ struct J9JImage; /* Forward struct declaration */
 struct J9JImageLocation;
 struct J9VMInterface;
 
+typedef struct J9PreparsedClassFile {
+	U_8* classData;
+	UDATA classDataLength;
+	UDATA translationFlags;
+	UDATA options;
+	U_8* buffer;
+} J9PreparsedClassFile;
+
 typedef struct J9TranslationLocalBuffer {
 	IDATA entryIndex;
 	I_32 loadLocationType;
 	struct J9ClassPathEntry* cpEntryUsed;
+	struct J9PreparsedClassFile* preparsedClassFile;
 } J9TranslationLocalBuffer;
 
 typedef struct J9TranslationBufferSet {
@@ -1802,6 +1828,8 @@ typedef struct J9TranslationBufferSet {
 	void  ( *reportStatisticsFunction)(struct J9JavaVM * javaVM, struct J9ClassLoader* loader, struct J9ROMClass* romClass, struct J9TranslationLocalBuffer *localBuffer) ;
 	UDATA  ( *internalLoadROMClassFunction)(struct J9VMThread * vmThread, struct J9LoadROMClassData *loadData, struct J9TranslationLocalBuffer *localBuffer) ;
 	IDATA  ( *transformROMClassFunction)(struct J9JavaVM *javaVM, struct J9PortLibrary *portLibrary, struct J9ROMClass *romClass, U_8 **classData, U_32 *size) ;
+	struct J9PreparsedClassFile*  ( *preparseClassFileFunction)(struct J9VMThread *vmThread, U_8 *classData, UDATA classDataLength, struct J9ClassLoader *classLoader, UDATA options) ;
+	void  ( *freePreparsedClassFileFunction)(struct J9JavaVM *javaVM, struct J9PreparsedClassFile *preparsedClassFile) ;
 } J9TranslationBufferSet;
 
 #define BCU_UNUSED_2  2
@@ -1864,6 +1892,7 @@ typedef struct J9BytecodeVerificationData {
 	struct J9ClassLoader* classLoader;
 	omrthread_monitor_t verifierMutex;
 	UDATA romClassInSharedClasses;
+	UDATA ramClassLookupCount;
 	UDATA* internalBufferStart;
 	UDATA* internalBufferEnd;
 	UDATA* currentAlloc;
@@ -2352,6 +2381,23 @@ typedef struct J9WalkStackFramesAndSlotsStorage {
 #endif /* J9VM_ARCH_ARM */
 } J9WalkStackFramesAndSlotsStorage;
 
+#define J9_STACKMAP_CACHE_SIZE 4096
+
+/* Locals or pending stack map of one interpreted PC, for methods with at most 32 mapped slots */
+typedef struct J9StackMapCacheEntry {
+	volatile UDATA sequence; /* odd while the entry is being written */
+	struct J9ROMMethod* romMethod;
+	UDATA offsetPC;
+	UDATA pushCount; /* 0 for a locals map, otherwise the pending stack height */
+	UDATA romClassSegmentFreeCount; /* vm->romClassSegmentFreeCount when the entry was written */
+	void* localMapFunction; /* vm->localMapFunction when the entry was written, as a debugger can install a wider mapper */
+	U_32 bits;
+} J9StackMapCacheEntry;
+
+typedef struct J9StackMapCache {
+	J9StackMapCacheEntry entries[J9_STACKMAP_CACHE_SIZE];
+} J9StackMapCache;
+
 typedef struct J9I2JState {
 	UDATA* returnSP;
 	UDATA* a0;
@@ -3660,6 +3706,9 @@ typedef struct J9JITConfig {
 	UDATA ( *jitGetExceptionCatcher)(struct J9VMThread *currentThread, void *handlerPC, struct J9JITExceptionTable *metaData, struct J9Method **method, IDATA *location) ;
 	void ( *jitMethodBreakpointed)(struct J9VMThread *currentThread, struct J9Method *method) ;
 	void ( *jitMethodUnbreakpointed)(struct J9VMThread *currentThread, struct J9Method *method) ;
+	void ( *jitCodeBreakpointBatchStarted)(struct J9VMThread *currentThread) ;
+	void ( *jitCodeBreakpointBatchEnded)(struct J9VMThread *currentThread) ;
+	UDATA codeBreakpointBatchDepth;
 } J9JITConfig;
 
 #define J9JIT_GROW_CACHES  0x100000
@@ -4015,6 +4064,9 @@ typedef struct J9AOTConfig {
 	UDATA ( *jitGetExceptionCatcher)(struct J9VMThread *currentThread, void *handlerPC, struct J9JITExceptionTable *metaData, struct J9Method **method, IDATA *location) ;
 	void ( *jitMethodBreakpointed)(struct J9VMThread *currentThread, struct J9Method *method) ;
 	void ( *jitMethodUnbreakpointed)(struct J9VMThread *currentThread, struct J9Method *method) ;
+	void ( *jitCodeBreakpointBatchStarted)(struct J9VMThread *currentThread) ;
+	void ( *jitCodeBreakpointBatchEnded)(struct J9VMThread *currentThread) ;
+	UDATA codeBreakpointBatchDepth;
 	struct J9AOTCallbackFunctionTable* callbackFunctionTable;
 	UDATA virtualCodeBaseAddress;
 	UDATA virtualDataBaseAddress;
@@ -4905,6 +4957,9 @@ typedef struct J9VMThread {
 	void* osrScratchBuffer;
 	void* jitArtifactSearchCache;
 	void* jitExceptionHandlerCache;
+	void* stackTraceFrameCache;
+	UDATA stackMapCacheHits;
+	UDATA stackMapCacheMisses;
 	void* jitPrivateData;
 	struct J9Method* jitMethodToBeCompiled;
 	UDATA privateFlags2;
@@ -5090,6 +5145,8 @@ typedef struct J9JavaVM {
 	struct J9MemorySegmentList* memorySegments;
 	struct J9MemorySegmentList* objectMemorySegments;
 	struct J9MemorySegmentList* classMemorySegments;
+	UDATA romClassSegmentFreeCount;
+	struct J9StackMapCache* stackMapCache;
 	UDATA stackSize;
 	UDATA ramClassAllocationIncrement;
 	UDATA romClassAllocationIncrement;
@@ -5132,6 +5189,7 @@ typedef struct J9JavaVM {
 	j9object_t destroyVMState;
 	omrthread_monitor_t segmentMutex;
 	omrthread_monitor_t jniFrameMutex;
+	omrthread_monitor_t jniGlobalReferencesMutex;
 	UDATA verboseLevel;
 	UDATA finalizeFlags;
 	UDATA rsOverflow;
@@ -5189,6 +5247,7 @@ typedef struct J9JavaVM {
 	UDATA thrMaxTryEnterYieldsBeforeBlocking;
 	UDATA thrNestedSpinning;
 	UDATA thrTryEnterNestedSpinning;
+	UDATA thrAdaptiveTryEnterSpinning;
 	UDATA thrDeflationPolicy;
 	UDATA gcOptions;
 	UDATA  ( *unhookVMEvent)(struct J9JavaVM *javaVM, UDATA eventNumber, void * currentHandler, void * oldHandler) ;
@@ -5236,6 +5295,7 @@ typedef struct J9JavaVM {
 	omrthread_monitor_t monitorTableMutex;
 	struct J9MonitorTableListEntry* monitorTableList;
 	struct J9Pool* monitorTableListPool;
+	j9objectmonitor_t* monitorTableLookupCache;
 	UDATA thrStaggerStep;
 	UDATA thrStaggerMax;
 	UDATA thrStagger;
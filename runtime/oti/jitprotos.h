@@ -76,6 +76,8 @@ extern J9_CFUNC void   jitCodeBreakpointAdded (J9VMThread * currentThread, J9Met
 extern J9_CFUNC void   jitSingleStepAdded (J9VMThread * currentThread);
 extern J9_CFUNC void   jitDecompileMethod (J9VMThread * currentThread, J9JITDecompilationInfo * decompRecord);
 extern J9_CFUNC void   jitCodeBreakpointRemoved (J9VMThread * currentThread, J9Method * method);
+extern J9_CFUNC void   jitCodeBreakpointBatchStarted (J9VMThread * currentThread);
+extern J9_CFUNC void   jitCodeBreakpointBatchEnded (J9VMThread * currentThread);
 extern J9_CFUNC UDATA  jitIsMethodBreakpointed(J9VMThread *currentThread, J9Method *method);
 
 extern J9_CFUNC void   c_jitDecompileAfterAllocation(J9VMThread * currentThread);
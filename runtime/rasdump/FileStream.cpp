@@ -25,11 +25,17 @@
 #include "FileStream.hpp"
 #include "../oti/util_api.h"
 
+/* Size of the buffer used to batch the many small writes of a binary dump */
+#define FILESTREAM_BUFFER_SIZE (1024 * 1024)
+
 /* Constructor */
 FileStream::FileStream(J9PortLibrary* portLibrary) :
 	_PortLibrary(portLibrary),
 	_FileHandle(-1),
-	_Error(0)
+	_Error(0),
+	_Buffer(NULL),
+	_BufferPos(0),
+	_BufferSize(0)
 {
 	/* Nothing to do */
 }
@@ -47,6 +53,14 @@ FileStream::open(const char* fileName)
 	if (fileName[0] != '-' ) {
 		_FileHandle = j9cached_file_open(_PortLibrary, fileName, EsOpenWrite | EsOpenCreate | EsOpenTruncate | EsOpenCreateNoTag, 0666);
 		_Error = 0;
+
+		/* Writes are unbuffered if the buffer cannot be allocated */
+		if ((_FileHandle != -1) && (_Buffer == NULL)) {
+			PORT_ACCESS_FROM_PORT(_PortLibrary);
+			_Buffer = (char *)j9mem_allocate_memory(FILESTREAM_BUFFER_SIZE, OMRMEM_CATEGORY_VM);
+			_BufferSize = (_Buffer == NULL) ? 0 : FILESTREAM_BUFFER_SIZE;
+		}
+		_BufferPos = 0;
 	}
 }
 
@@ -54,12 +68,38 @@ FileStream::open(const char* fileName)
 void 
 FileStream::close(void)
 {
+	PORT_ACCESS_FROM_PORT(_PortLibrary);
+
 	if (_FileHandle != -1) {
+		flush();
 		j9cached_file_sync(_PortLibrary, _FileHandle);
 		j9cached_file_close(_PortLibrary, _FileHandle);
 	}
 
 	_FileHandle = -1;	
+
+	if (_Buffer != NULL) {
+		j9mem_free_memory(_Buffer);
+		_Buffer = NULL;
+	}
+	_BufferPos  = 0;
+	_BufferSize = 0;
+}
+
+/* Method for writing any buffered data to the file */
+void
+FileStream::flush(void)
+{
+	if ((_FileHandle != -1) && (_BufferPos != 0)) {
+		if (!_Error) {
+			IDATA rc = j9cached_file_write(_PortLibrary, _FileHandle, _Buffer, _BufferPos);
+
+			if (rc != (IDATA)_BufferPos) {
+				_Error = rc;
+			}
+		}
+		_BufferPos = 0;
+	}
 }
 
 /* Methods for getting the object's status */
@@ -78,10 +118,28 @@ void
 FileStream::writeCharacters(const char* data, IDATA length)
 {
 	if (_FileHandle != -1 && ! _Error) {
-		IDATA rc = j9cached_file_write(_PortLibrary, _FileHandle, data, length);
+		/* Small writes are gathered in the buffer, which is written out once full */
+		if ((_Buffer != NULL) && ((UDATA)length <= (_BufferSize - _BufferPos))) {
+			memcpy(_Buffer + _BufferPos, data, length);
+			_BufferPos += length;
+			return;
+		}
+
+		flush();
+		if (_Error) {
+			return;
+		}
+
+		if ((UDATA)length < _BufferSize) {
+			memcpy(_Buffer, data, length);
+			_BufferPos = length;
+		} else {
+			/* Too big to be worth buffering (or there is no buffer) so write it straight out */
+			IDATA rc = j9cached_file_write(_PortLibrary, _FileHandle, data, length);
 
-		if (rc != length) {
-			_Error = rc;
+			if (rc != length) {
+				_Error = rc;
+			}
 		}
 	}
 }
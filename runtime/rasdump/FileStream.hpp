@@ -45,6 +45,9 @@ public :
 	/* Method for closing the file */
 	void close(void);
 
+	/* Method for writing any buffered data to the file */
+	void flush(void);
+
 	/* Methods for getting the object's status */
 	bool isOpen(void) const;
 	bool hasError(void) const;
@@ -64,6 +67,9 @@ protected :
 	J9PortLibrary* _PortLibrary;
 	IDATA          _FileHandle;
 	IDATA          _Error;
+	char*          _Buffer;
+	UDATA          _BufferPos;
+	UDATA          _BufferSize;
 };
 
 #endif
@@ -1163,6 +1163,12 @@ BinaryHeapDumpWriter::BinaryHeapDumpWriter(const char* fileName, J9RASdumpContex
 			writeDumpFileTrailer();
 		}
 
+		/* Write out the buffered records now so that a failure is reported */
+		if (! _Error) {
+			_OutputStream.flush();
+			checkForIOError();
+		}
+
 		/* Performance measuring code 
 		stopTimer();
 		*/
@@ -1250,6 +1256,12 @@ BinaryHeapDumpWriter::openNewDumpFile(J9MM_IterateSpaceDescriptor* spaceDescript
 			writeDumpFileTrailer();
 		}
 
+		/* Write out the buffered records now so that a failure is reported */
+		if (! _Error) {
+			_OutputStream.flush();
+			checkForIOError();
+		}
+
 		/* Record the status of the operation */
 		_FileMode = _FileMode || _OutputStream.isOpen();
 
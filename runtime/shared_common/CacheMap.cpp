@@ -2408,6 +2408,7 @@ SH_CacheMap::findROMClass(J9VMThread* currentThread, const char* path, Classpath
 	SH_ROMClassManager* localRCM;
 	UDATA hash = 0;
 	bool useWriteHash = _ccHead->isUsingWriteHash();
+	bool inReaderSlot = false;
 
 	Trc_SHR_Assert_ShouldHaveLocalMutex(currentThread->javaVM->classMemorySegments->segmentMutex);
 
@@ -2429,26 +2430,47 @@ SH_CacheMap::findROMClass(J9VMThread* currentThread, const char* path, Classpath
 		}
 	}
 
-	/* THREADING: We enter read mutex here. Multiple readers can read concurrently.
-	 * Readers can also read at the same time as a writer is writing. The mutex therefore serves
+	/* THREADING: Readers can read at the same time as a writer is writing. The read mutex serves
 	 * to indicate to the writers when readers have finished reading, incase they want a lock.
+	 * The read mutex updates the shared reader count, which every JVM attached to the cache contends on,
+	 * so the lookup first registers in the reader slot of this JVM instead. It is repeated holding the
+	 * read mutex if an item needs to be marked stale, as marking locks the cache.
 	 */
-	if (_ccHead->enterReadMutex(currentThread, fnName) != 0) {
+	inReaderSlot = _ccHead->enterReaderSlot(currentThread);
+	if (!inReaderSlot && (_ccHead->enterReadMutex(currentThread, fnName) != 0)) {
 		Trc_SHR_CM_findROMClass_FailedMutex(currentThread, path, cp->getHelperID());
 		Trc_SHR_CM_findROMClass_Exit_Null(currentThread);
 		return NULL;
 	}
 
 	if (runEntryPointChecks(currentThread, NULL, NULL) == -1) {
-		_ccHead->exitReadMutex(currentThread, fnName);
+		if (inReaderSlot) {
+			_ccHead->exitReaderSlot(currentThread);
+		} else {
+			_ccHead->exitReadMutex(currentThread, fnName);
+		}
 		/* trace event is at level 1 and trace exit message is at level 2 as per CMVC 155318/157683 */
 		Trc_SHR_CM_findROMClass_Exit_Null_Event(currentThread, path, cp->getHelperID());
 		Trc_SHR_CM_findROMClass_Exit_Null(currentThread);
 		return NULL;
 	}		
 
-	rc = localRCM->locateROMClass(currentThread, path, pathLen, cp, -1, confirmedEntries, cp->getHelperID(), NULL, partition, modContext, &locateResult);
-	if ((rc & LOCATE_ROMCLASS_RETURN_MARKED_ITEM_STALE) != LOCATE_ROMCLASS_RETURN_MARKED_ITEM_STALE) {
+	rc = localRCM->locateROMClass(currentThread, path, pathLen, cp, -1, confirmedEntries, cp->getHelperID(), NULL, partition, modContext, &locateResult, inReaderSlot);
+	if (inReaderSlot) {
+		_ccHead->exitReaderSlot(currentThread);
+		if ((rc & LOCATE_ROMCLASS_RETURN_STALE_ITEM_NOT_MARKED) == LOCATE_ROMCLASS_RETURN_STALE_ITEM_NOT_MARKED) {
+			Trc_SHR_CM_findROMClass_LockFreeReadRetry(currentThread, path, cp->getHelperID(), rc);
+			if (_ccHead->enterReadMutex(currentThread, fnName) != 0) {
+				Trc_SHR_CM_findROMClass_FailedMutex(currentThread, path, cp->getHelperID());
+				Trc_SHR_CM_findROMClass_Exit_Null(currentThread);
+				return NULL;
+			}
+			rc = localRCM->locateROMClass(currentThread, path, pathLen, cp, -1, confirmedEntries, cp->getHelperID(), NULL, partition, modContext, &locateResult);
+			if ((rc & LOCATE_ROMCLASS_RETURN_MARKED_ITEM_STALE) != LOCATE_ROMCLASS_RETURN_MARKED_ITEM_STALE) {
+				_ccHead->exitReadMutex(currentThread, fnName);
+			}
+		}
+	} else if ((rc & LOCATE_ROMCLASS_RETURN_MARKED_ITEM_STALE) != LOCATE_ROMCLASS_RETURN_MARKED_ITEM_STALE) {
 		_ccHead->exitReadMutex(currentThread, fnName);
 	}
 
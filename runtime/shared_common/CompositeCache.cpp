@@ -2108,21 +2108,29 @@ SH_CompositeCacheImpl::doLockCache(J9VMThread* currentThread)
 
 	unprotectHeaderReadWriteArea(currentThread, false);
 	setIsLocked(true);
+	/* THREADING: The locked flag must be visible before the reader counts are read. Readers increment
+	 * their count before checking the flag (see enterReadMutex() and enterReaderSlot()), so either the
+	 * reader sees the cache locked or the count of the reader is seen here.
+	 */
+	VM_AtomicSupport::readWriteBarrier();
 	/* The metadata is changing and so mark the CRC as invalid. */
 	/* TODO: This will not work for cachelets - need to reorganised how the CRCing is done */
 	_theca->crcValid = 0;
 	protectHeaderReadWriteArea(currentThread, false);
-	while ((patienceCntr < CACHE_LOCK_PATIENCE_COUNTER) && (_theca->readerCount>0)) {
+	while ((patienceCntr < CACHE_LOCK_PATIENCE_COUNTER) && ((_theca->readerCount > 0) || (getSlotReaderCount() > 0))) {
 		omrthread_sleep(5);
 		++patienceCntr;
 	}
 	if ((CACHE_LOCK_PATIENCE_COUNTER == patienceCntr) 
-		&& (_theca->readerCount > 0)
+		&& ((_theca->readerCount > 0) || (getSlotReaderCount() > 0))
 	) {
 		/* Reader has almost certainly died. Cannot wait forever. Whack to zero and proceed. */
 		Trc_SHR_CC_doLockCache_EventWhackedToZero(currentThread);
 		unprotectHeaderReadWriteArea(currentThread, false);
 		_theca->readerCount = 0;
+		for (UDATA i = 0; i < J9SH_READER_SLOT_COUNT; i++) {
+			*getReaderSlot(i) = 0;
+		}
 		protectHeaderReadWriteArea(currentThread, false);
 	}
 
@@ -2448,6 +2456,113 @@ SH_CompositeCacheImpl::enterReadMutex(J9VMThread* currentThread, const char* cal
 	return rc;
 }
 
+/**
+ * Register a read of the cache metadata in the reader slot of this JVM
+ *
+ * Readers normally register with enterReadMutex(), which updates the shared readerCount. Every JVM
+ * attached to the cache contends on that word. A reader slot counts the same way but sits in a cache
+ * line of its own, and JVMs attached at the same time are given different slots. doLockCache() waits
+ * for the slots as well as readerCount, so the metadata is not changed while a slot reader is reading.
+ *
+ * Unlike enterReadMutex() this never waits for the cache to be unlocked, so the caller must fall back
+ * to enterReadMutex() when it fails. A thread holding a reader slot must not lock the cache.
+ *
+ * @param [in] currentThread  Pointer to J9VMThread structure for the current thread
+ *
+ * @return true if the read is registered and must be ended with exitReaderSlot(), false if enterReadMutex() must be used
+ */
+bool
+SH_CompositeCacheImpl::enterReaderSlot(J9VMThread* currentThread)
+{
+	volatile UDATA* slot;
+	UDATA oldNum, value;
+
+	if (!_started) {
+		Trc_SHR_Assert_ShouldNeverHappen();
+		return false;
+	}
+
+	/* Read-only caches do not maintain reader counts */
+	if (_readOnlyOSCache || (_commonCCInfo->writeMutexID == CC_READONLY_LOCK_VALUE)) {
+		return false;
+	}
+
+	slot = getReaderSlot(_commonCCInfo->vmID % J9SH_READER_SLOT_COUNT);
+	oldNum = *slot;
+	unprotectHeaderReadWriteArea(currentThread, false);
+	do {
+		value = oldNum + 1;
+		oldNum = VM_AtomicSupport::lockCompareExchange((UDATA*)slot, oldNum, value);
+	} while (value != (oldNum + 1));
+	protectHeaderReadWriteArea(currentThread, false);
+
+	/* THREADING: Important to increment the slot before checking isLocked(), as the incremented
+	 * slot prevents a lock from occurring. lockCompareExchange() is a full barrier.
+	 */
+	if (isLocked()) {
+		Trc_SHR_CC_enterReaderSlot_Locked(currentThread, _commonCCInfo->vmID % J9SH_READER_SLOT_COUNT);
+		exitReaderSlot(currentThread);
+		return false;
+	}
+	return true;
+}
+
+/**
+ * End a read registered with enterReaderSlot()
+ *
+ * @param [in] currentThread  Pointer to J9VMThread structure for the current thread
+ */
+void
+SH_CompositeCacheImpl::exitReaderSlot(J9VMThread* currentThread)
+{
+	volatile UDATA* slot = getReaderSlot(_commonCCInfo->vmID % J9SH_READER_SLOT_COUNT);
+	UDATA oldNum = *slot;
+	UDATA value;
+
+	unprotectHeaderReadWriteArea(currentThread, false);
+	do {
+		if (0 == oldNum) {
+			/* This can happen if the slot is whacked to 0 by doLockCache() */
+			PORT_ACCESS_FROM_PORT(_portlib);
+			CC_ERR_TRACE(J9NLS_SHRC_CC_NEGATIVE_READER_COUNT);
+			break;
+		}
+		value = oldNum - 1;
+		oldNum = VM_AtomicSupport::lockCompareExchange((UDATA*)slot, oldNum, value);
+	} while (value != (oldNum - 1));
+	protectHeaderReadWriteArea(currentThread, false);
+}
+
+/**
+ * Get a reader slot in the cache header. The slots are aligned to J9SH_READER_SLOT_BYTES from the
+ * address the header is mapped at, which is page aligned, so every JVM finds a slot at the same offset.
+ *
+ * @param [in] index  The slot, less than J9SH_READER_SLOT_COUNT
+ *
+ * @return the reader count of the slot
+ */
+volatile UDATA*
+SH_CompositeCacheImpl::getReaderSlot(UDATA index)
+{
+	UDATA slotArea = ROUND_UP_TO((UDATA)J9SH_READER_SLOT_BYTES, (UDATA)_theca->readerSlots);
+
+	return (volatile UDATA*)(slotArea + (index * J9SH_READER_SLOT_BYTES));
+}
+
+/**
+ * @return the number of reads registered in all the reader slots
+ */
+UDATA
+SH_CompositeCacheImpl::getSlotReaderCount(void)
+{
+	UDATA count = 0;
+
+	for (UDATA i = 0; i < J9SH_READER_SLOT_COUNT; i++) {
+		count += *getReaderSlot(i);
+	}
+	return count;
+}
+
 /**
  * Exit read mutex
  *
@@ -4106,7 +4221,7 @@ SH_CompositeCacheImpl::getReaderCount(J9VMThread* currentThread)
 		return 0;
 	}
 	if (!_readOnlyOSCache) {
-		return _theca->readerCount;
+		return _theca->readerCount + getSlotReaderCount();
 	} else {
 		return _readOnlyReaderCount;			/* Maintained so that our assertions still work */
 	}
@@ -120,6 +120,10 @@ public:
 
 	void exitReadMutex(J9VMThread* currentThread, const char* caller);
 
+	bool enterReaderSlot(J9VMThread* currentThread);
+
+	void exitReaderSlot(J9VMThread* currentThread);
+
 	BlockPtr allocateBlock(J9VMThread* currentThread, ShcItem* itemToWrite, U_32 align, U_32 alignOffset);
 
 	BlockPtr allocateWithSegment(J9VMThread* currentThread, ShcItem* itemToWrite, U_32 segBufSize, BlockPtr* segBuf);
@@ -540,6 +544,8 @@ private:
 
 	void incReaderCount(J9VMThread* currentThread);
 	void decReaderCount(J9VMThread* currentThread);
+	volatile UDATA* getReaderSlot(UDATA index);
+	UDATA getSlotReaderCount(void);
 
 	void initialize(J9JavaVM* vm, BlockPtr memForConstructor, J9SharedClassConfig* sharedClassConfig, const char* cacheName, I_32 cacheTypeRequired, bool startupForStats);
 	void initializeWithCommonInfo(J9JavaVM* vm, J9SharedClassConfig* sharedClassConfig, BlockPtr memForConstructor, const char* cacheName, I_32 newPersistentCacheReqd, bool startupForStats);
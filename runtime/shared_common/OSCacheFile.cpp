@@ -458,6 +458,8 @@ SH_OSCacheFile::getMmapHeaderFieldOffsetForGen(UDATA headerGen, UDATA fieldID)
 {
 	switch(headerGen) {
 	case OSCACHE_CURRENT_CACHE_GEN :
+	case 36:
+	case 35:
 	case 34:
 	case 33:
 	case 32:
@@ -1898,6 +1898,8 @@ SH_OSCachesysv::getSysvHeaderFieldOffsetForGen(UDATA headerGen, UDATA fieldID)
 {
 	switch(headerGen) {
 	case OSCACHE_CURRENT_CACHE_GEN :
+	case 36:
+	case 35:
 	case 34:
 	case 33:
 	case 32:
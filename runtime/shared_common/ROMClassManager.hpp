@@ -50,6 +50,7 @@ struct LocateROMClassResult {
 /* information flags */
 #define LOCATE_ROMCLASS_RETURN_MARKED_ITEM_STALE 8
 #define LOCATE_ROMCLASS_RETURN_FOUND_SHADOW 16
+#define LOCATE_ROMCLASS_RETURN_STALE_ITEM_NOT_MARKED 32
 
 /**
  * Sub-interface of SH_Manager used for managing ROMClasses in the cache
@@ -63,7 +64,7 @@ public:
 	typedef char* BlockPtr;
 
 	virtual UDATA locateROMClass(J9VMThread* currentThread, const char* path, U_16 pathLen, ClasspathItem* cp, I_16 cpeIndex, IDATA confirmedEntries, IDATA callerHelperID, 
-					const J9ROMClass* cachedROMClass, const J9UTF8* partition, const J9UTF8* modContext, LocateROMClassResult* result) = 0;
+					const J9ROMClass* cachedROMClass, const J9UTF8* partition, const J9UTF8* modContext, LocateROMClassResult* result, bool inReaderSlot = false) = 0;
 
 	virtual const J9ROMClass* findNextExisting(J9VMThread* currentThread, void * &findNextIterator, void * &firstFound, U_16 classnameLength, const char* classnameData) = 0;
 
@@ -363,6 +363,8 @@ SH_ROMClassManagerImpl::existsClassForName(J9VMThread* currentThread, const char
  * @param[in] partition The partition if one is in use
  * @param[in] modContext The modification context if one is in use
  * @param[out] result A LocateROMClassResult should be provided into which the results are written
+ * @param[in] inReaderSlot True if the read is registered in a reader slot rather than holding the read mutex (see SH_CompositeCacheImpl::enterReaderSlot()).
+ * 		An out of date class is then not marked stale, as marking locks the cache, which waits for the slot reader to finish.
  *
  * Returns a number of potential flags indicating results
  * @return LOCATE_ROMCLASS_RETURN_FOUND if a ROMClass was found and validated
@@ -371,11 +373,12 @@ SH_ROMClassManagerImpl::existsClassForName(J9VMThread* currentThread, const char
  * @return LOCATE_ROMCLASS_RETURN_DO_TRY_WAIT 4 indicates that the caller should try waiting for an update as another JVM is likely in the middle of adding the class
  * @return LOCATE_ROMCLASS_RETURN_MARKED_ITEM_STALE indicates an out of date class was found and it was marked stale. If the read mutex was held, it is released.
  * @return LOCATE_ROMCLASS_RETURN_FOUND_SHADOW indicates that the class was found, but a shadow has appeared earlier in the classpath which has made it invalid
+ * @return LOCATE_ROMCLASS_RETURN_STALE_ITEM_NOT_MARKED indicates an out of date class was found during a reader slot read. The caller should repeat the lookup holding the read mutex.
  */
 /* THREADING: This function can be called multi-threaded */
 UDATA
 SH_ROMClassManagerImpl::locateROMClass(J9VMThread* currentThread, const char* path, U_16 pathLen, ClasspathItem* cp, I_16 cpeIndex, IDATA confirmedEntries, IDATA callerHelperID, 
-						const J9ROMClass* cachedROMClass, const J9UTF8* partition, const J9UTF8* modContext, LocateROMClassResult* result) 
+						const J9ROMClass* cachedROMClass, const J9UTF8* partition, const J9UTF8* modContext, LocateROMClassResult* result, bool inReaderSlot) 
 {
 	RcLinkedListImpl* found = NULL;
 	RcLinkedListImpl* walk = NULL;
@@ -516,7 +519,11 @@ SH_ROMClassManagerImpl::locateROMClass(J9VMThread* currentThread, const char* pa
 				/* At this point, we have our match - just need to check timestamp if .class file and look for shadows */
 				if (match) {
 					if ((cp->getType() != CP_TYPE_TOKEN) && (*_runtimeFlagsPtr & J9SHR_RUNTIMEFLAG_ENABLE_TIMESTAMP_CHECKS)) {
-						if (match->timestamp!=0 && checkTimestamp(currentThread, path, pathLen, match, walk->_item)) {
+						if (match->timestamp!=0 && checkTimestamp(currentThread, path, pathLen, match, walk->_item, !inReaderSlot)) {
+							if (inReaderSlot) {
+								Trc_SHR_RMI_locateROMClass_ExitRcTimestampChanged(currentThread);
+								return (LOCATE_ROMCLASS_RETURN_STALE_ITEM_NOT_MARKED | LOCATE_ROMCLASS_RETURN_NOTFOUND);
+							}
 							/* At this point if the read mutex was held, it has been released. */
 							/* trace event is at level 1 and trace exit message is at level 2 as per CMVC 155318/157683  */
 							Trc_SHR_RMI_locateROMClass_TimestampChanged_Event(currentThread, pathLen, path, callerHelperID, cpeIndex);							
@@ -581,11 +588,11 @@ _notFound:
 }
 
 /* Check timestamp of ROMClass. 
- * If the timestamp has changed, exits the read mutex and acquires the write mutex if necessary,
+ * If the timestamp has changed and markStale is true, exits the read mutex and acquires the write mutex if necessary,
  * marks ROMClass stale, and returns true.
  */
 bool 
-SH_ROMClassManagerImpl::checkTimestamp(J9VMThread* currentThread, const char* path, UDATA pathLen, ROMClassWrapper* rcw, const ShcItem* item)
+SH_ROMClassManagerImpl::checkTimestamp(J9VMThread* currentThread, const char* path, UDATA pathLen, ROMClassWrapper* rcw, const ShcItem* item, bool markStale)
 {
 	ClasspathWrapper* cpw;
 	ClasspathEntryItem* cpeiInCache;
@@ -596,7 +603,9 @@ SH_ROMClassManagerImpl::checkTimestamp(J9VMThread* currentThread, const char* pa
 	cpeiInCache = ((ClasspathItem*)CPWDATA(cpw))->itemAt(rcw->cpeIndex);
 
 	if (_tsm->checkROMClassTimeStamp(currentThread, path, pathLen, cpeiInCache, rcw) != TIMESTAMP_UNCHANGED) {
-		_cache->markItemStaleCheckMutex(currentThread, item, false);
+		if (markStale) {
+			_cache->markItemStaleCheckMutex(currentThread, item, false);
+		}
 		Trc_SHR_RMI_checkTimestamp_ExitTrue(currentThread);
 		return true;
 	}
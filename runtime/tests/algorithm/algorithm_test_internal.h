@@ -77,6 +77,93 @@ I_32
 verifySimplePools(J9PortLibrary *portLib, UDATA *passCount, UDATA *failCount);
 
 
+/* ---------------- crc32test.c ---------------- */
+
+/**
+* @brief
+* @param *portLib
+* @param *passCount
+* @param *failCount
+* @return I_32
+*/
+I_32
+verifyCRC32(J9PortLibrary *portLib, UDATA *passCount, UDATA *failCount);
+
+/* ---------------- jitlooktest.c ---------------- */
+
+/**
+* @brief
+* @param *portLib
+* @param *passCount
+* @param *failCount
+* @return I_32
+*/
+I_32
+verifyJitArtifactSearch(J9PortLibrary *portLib, UDATA *passCount, UDATA *failCount);
+
+/* ---------------- jitlookcache.c ---------------- */
+
+#if defined(J9VM_INTERP_NATIVE_SUPPORT)
+
+#define JITLOOK_CODE_CACHES 8
+#define JITLOOK_CODE_CACHE_SIZE (1024 * 1024)
+#define JITLOOK_BUCKET_SHIFT 9
+#define JITLOOK_MAX_METHODS ((JITLOOK_CODE_CACHES * JITLOOK_CODE_CACHE_SIZE) / 256)
+
+/* A fake code cache: the hash table describing it and the metadata for the methods "compiled" into it */
+typedef struct JitLookCodeCache {
+	J9JITHashTable table;
+	UDATA *chains;
+} JitLookCodeCache;
+
+/* The fake code caches, the tree they are inserted in, and the memory their addresses come from */
+typedef struct JitLookCodeCaches {
+	J9AVLTree tree;
+	JitLookCodeCache caches[JITLOOK_CODE_CACHES];
+	J9JITExceptionTable *methods;
+	UDATA methodCount;
+	U_8 *memory;
+} JitLookCodeCaches;
+
+/**
+* @brief
+* @param *portLib
+* @param *caches
+* @return I_32
+*/
+I_32
+allocateJitLookCodeCaches(J9PortLibrary *portLib, JitLookCodeCaches *caches);
+
+/**
+* @brief
+* @param *portLib
+* @param *caches
+* @return void
+*/
+void
+freeJitLookCodeCaches(J9PortLibrary *portLib, JitLookCodeCaches *caches);
+
+/**
+* @brief
+* @param *caches
+* @param *stack
+* @param depth
+* @return void
+*/
+void
+fillJitLookStack(JitLookCodeCaches *caches, UDATA *stack, UDATA depth);
+
+/**
+* @brief
+* @param *tree
+* @param pc
+* @return J9JITExceptionTable *
+*/
+J9JITExceptionTable *
+jitLookReferenceSearch(J9AVLTree *tree, UDATA pc);
+
+#endif /* J9VM_INTERP_NATIVE_SUPPORT */
+
 /* ---------------- wildcardtest.c ---------------- */
 
 /**
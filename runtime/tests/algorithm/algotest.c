@@ -78,6 +78,14 @@ UDATA signalProtectedMain(struct J9PortLibrary *portLibrary, void *arg)
 		numSuitesNotRun++;
 	}
 
+	if (verifyCRC32(PORTLIB, &passCount, &failCount)) {
+		numSuitesNotRun++;
+	}
+
+	if (verifyJitArtifactSearch(PORTLIB, &passCount, &failCount)) {
+		numSuitesNotRun++;
+	}
+
 	j9tty_printf( PORTLIB, "Algorithm Test Finished\n");
 	j9tty_printf( PORTLIB, "total tests: %d\n", passCount + failCount);
 	j9tty_printf( PORTLIB, "total passes: %d\n", passCount);
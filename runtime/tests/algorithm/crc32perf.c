@@ -0,0 +1,83 @@
+/*******************************************************************************
+ * Copyright (c) 2017, 2017 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+
+/*
+ * Times j9crc32() against the byte at a time table loop it replaced. This is a measurement, not a
+ * test: algotest checks that the results are bit exact.
+ */
+
+#include "j9protos.h"
+#include "j9port.h"
+#include "exelib_api.h"
+#include "util_api.h"
+
+#define CRC_BENCHMARK_BUFFER_SIZE (16 * 1024 * 1024)
+#define CRC_BENCHMARK_ITERATIONS 8
+
+UDATA
+signalProtectedMain(struct J9PortLibrary *portLibrary, void *arg)
+{
+	U_8 *benchmarkBuffer = NULL;
+	U_32 i = 0;
+	U_32 crc = 0;
+	U_32 expected = 0;
+	U_64 startTime = 0;
+	U_64 referenceTime = 0;
+	U_64 sliceTime = 0;
+	UDATA rc = 0;
+	PORT_ACCESS_FROM_PORT(portLibrary);
+
+	benchmarkBuffer = j9mem_allocate_memory(CRC_BENCHMARK_BUFFER_SIZE, OMRMEM_CATEGORY_VM);
+	if (NULL == benchmarkBuffer) {
+		j9tty_err_printf(PORTLIB, "Unable to allocate CRC benchmark buffer\n");
+		return 1;
+	}
+	for (i = 0; i < CRC_BENCHMARK_BUFFER_SIZE; i++) {
+		benchmarkBuffer[i] = (U_8)(i * 7);
+	}
+
+	startTime = j9time_hires_clock();
+	for (i = 0; i < CRC_BENCHMARK_ITERATIONS; i++) {
+		/* a step of one is the byte at a time table loop j9crc32() used before slicing-by-8 */
+		expected = j9crcSparse32(j9crc32(0, NULL, 0), benchmarkBuffer, CRC_BENCHMARK_BUFFER_SIZE, 1);
+	}
+	referenceTime = j9time_hires_delta(startTime, j9time_hires_clock(), J9PORT_TIME_DELTA_IN_MICROSECONDS);
+
+	startTime = j9time_hires_clock();
+	for (i = 0; i < CRC_BENCHMARK_ITERATIONS; i++) {
+		crc = j9crc32(0, benchmarkBuffer, CRC_BENCHMARK_BUFFER_SIZE);
+	}
+	sliceTime = j9time_hires_delta(startTime, j9time_hires_clock(), J9PORT_TIME_DELTA_IN_MICROSECONDS);
+
+	j9mem_free_memory(benchmarkBuffer);
+
+	if (expected != crc) {
+		/* algotest reports the details, a mismatch only invalidates the timings here */
+		j9tty_err_printf(PORTLIB, "CRC benchmark mismatch: got 0x%x expected 0x%x\n", crc, expected);
+		rc = 1;
+	}
+
+	j9tty_printf(PORTLIB, "CRC32 of %u MB x %u: byte at a time %llu usec, j9crc32 %llu usec\n",
+			CRC_BENCHMARK_BUFFER_SIZE / (1024 * 1024), CRC_BENCHMARK_ITERATIONS, referenceTime, sliceTime);
+
+	return rc;
+}
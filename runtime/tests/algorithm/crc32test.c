@@ -0,0 +1,110 @@
+/*******************************************************************************
+ * Copyright (c) 2017, 2017 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+
+#include "j9protos.h"
+#include "j9port.h"
+#include "util_api.h"
+
+#define CRC_TEST_BUFFER_SIZE 1024
+
+static U_32 referenceCRC32(U_32 crc, U_8 *bytes, U_32 len);
+
+I_32
+verifyCRC32(J9PortLibrary *portLib, UDATA *passCount, UDATA *failCount)
+{
+	U_8 testBuffer[CRC_TEST_BUFFER_SIZE + 8];
+	U_32 offset = 0;
+	U_32 length = 0;
+	U_32 i = 0;
+	U_32 crc = 0;
+	U_32 expected = 0;
+	PORT_ACCESS_FROM_PORT(portLib);
+
+	j9tty_printf(PORTLIB, "Testing CRC32 functions...\n");
+
+	/* standard check value for CRC-32 */
+	crc = j9crc32(j9crc32(0, NULL, 0), (U_8 *)"123456789", 9);
+	if (0xcbf43926 != crc) {
+		j9tty_err_printf(PORTLIB, "Unexpected CRC 0x%x for check string, expected 0xcbf43926\n", crc);
+		(*failCount)++;
+	} else {
+		(*passCount)++;
+	}
+
+	for (i = 0; i < sizeof(testBuffer); i++) {
+		testBuffer[i] = (U_8)((i * 131) ^ (i >> 3));
+	}
+
+	/* every alignment and every tail length must match the byte at a time result */
+	for (offset = 0; offset < 8; offset++) {
+		for (length = 0; length <= CRC_TEST_BUFFER_SIZE; length++) {
+			expected = referenceCRC32(0, testBuffer + offset, length);
+			crc = j9crc32(0, testBuffer + offset, length);
+			if (expected != crc) {
+				j9tty_err_printf(PORTLIB, "CRC mismatch at offset %u length %u: got 0x%x expected 0x%x\n", offset, length, crc, expected);
+				(*failCount)++;
+				return 0;
+			}
+			/* CRCs computed in pieces must chain */
+			crc = j9crc32(0, testBuffer + offset, length / 3);
+			crc = j9crc32(crc, testBuffer + offset + (length / 3), length - (length / 3));
+			if (expected != crc) {
+				j9tty_err_printf(PORTLIB, "Chained CRC mismatch at offset %u length %u: got 0x%x expected 0x%x\n", offset, length, crc, expected);
+				(*failCount)++;
+				return 0;
+			}
+		}
+	}
+	(*passCount)++;
+
+	/* a step of one is the byte at a time table loop j9crc32() used before slicing-by-8 */
+	expected = j9crcSparse32(j9crc32(0, NULL, 0), testBuffer, sizeof(testBuffer), 1);
+	crc = j9crc32(0, testBuffer, sizeof(testBuffer));
+	if (expected != crc) {
+		j9tty_err_printf(PORTLIB, "CRC mismatch with j9crcSparse32: got 0x%x expected 0x%x\n", crc, expected);
+		(*failCount)++;
+	} else {
+		(*passCount)++;
+	}
+
+	j9tty_printf(PORTLIB, "Finished testing CRC32 functions.\n");
+
+	return 0;
+}
+
+/**
+ * Bitwise CRC-32 used as the reference for j9crc32()
+ */
+static U_32
+referenceCRC32(U_32 crc, U_8 *bytes, U_32 len)
+{
+	U_32 bit = 0;
+
+	crc = crc ^ 0xffffffff;
+	while (len-- > 0) {
+		crc ^= *bytes++;
+		for (bit = 0; bit < 8; bit++) {
+			crc = (crc >> 1) ^ ((0 - (crc & 1)) & 0xedb88320);
+		}
+	}
+	return crc ^ 0xffffffff;
+}
@@ -0,0 +1,224 @@
+/*******************************************************************************
+ * Copyright (c) 2017, 2017 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ *******************************************************************************/
+
+#include <string.h>
+#include "j9protos.h"
+#include "j9port.h"
+#include "avl_api.h"
+#include "util_api.h"
+#include "algorithm_test_internal.h"
+
+#if defined(J9VM_INTERP_NATIVE_SUPPORT)
+
+static UDATA hashIndex(UDATA index);
+static IDATA insertionCompare(J9AVLTree *tree, J9JITHashTable *insertNode, J9JITHashTable *walkNode);
+static IDATA searchCompare(J9AVLTree *tree, UDATA searchValue, J9JITHashTable *walkNode);
+static UDATA populateCodeCache(J9PortLibrary *portLib, JitLookCodeCache *cache, UDATA start, J9JITExceptionTable *methods, UDATA salt);
+
+/**
+ * Build several fake code caches in the same layout jithash.cpp produces, with methods of varying
+ * size (including methods which share a bucket, so some buckets hold chains), and insert them into
+ * a code cache tree.
+ * @return 0 on success, -1 on allocation failure (the caches must still be freed)
+ */
+I_32
+allocateJitLookCodeCaches(J9PortLibrary *portLib, JitLookCodeCaches *caches)
+{
+	UDATA i = 0;
+	PORT_ACCESS_FROM_PORT(portLib);
+
+	memset(caches, 0, sizeof(*caches));
+	caches->tree.insertionComparator = (IDATA (*)(J9AVLTree *, J9AVLTreeNode *, J9AVLTreeNode *))insertionCompare;
+	caches->tree.searchComparator = (IDATA (*)(J9AVLTree *, UDATA, J9AVLTreeNode *))searchCompare;
+	caches->tree.portLibrary = OMRPORT_FROM_J9PORT(PORTLIB);
+
+	/* the code is never executed, the memory only provides distinct addresses for the fake caches */
+	caches->memory = j9mem_allocate_memory(JITLOOK_CODE_CACHES * JITLOOK_CODE_CACHE_SIZE, OMRMEM_CATEGORY_JIT);
+	caches->methods = j9mem_allocate_memory(JITLOOK_MAX_METHODS * sizeof(J9JITExceptionTable), OMRMEM_CATEGORY_JIT);
+	if ((NULL == caches->memory) || (NULL == caches->methods)) {
+		return -1;
+	}
+	memset(caches->methods, 0, JITLOOK_MAX_METHODS * sizeof(J9JITExceptionTable));
+
+	for (i = 0; i < JITLOOK_CODE_CACHES; i++) {
+		/* insert the caches out of address order so the tree has to balance */
+		UDATA cacheIndex = (i * 5) % JITLOOK_CODE_CACHES;
+		UDATA count = populateCodeCache(PORTLIB, &caches->caches[cacheIndex],
+				(UDATA)caches->memory + (cacheIndex * JITLOOK_CODE_CACHE_SIZE), caches->methods + caches->methodCount, cacheIndex);
+		if (0 == count) {
+			return -1;
+		}
+		caches->methodCount += count;
+		avl_insert(&caches->tree, (J9AVLTreeNode *)&caches->caches[cacheIndex].table);
+	}
+
+	return 0;
+}
+
+void
+freeJitLookCodeCaches(J9PortLibrary *portLib, JitLookCodeCaches *caches)
+{
+	UDATA i = 0;
+	PORT_ACCESS_FROM_PORT(portLib);
+
+	for (i = 0; i < JITLOOK_CODE_CACHES; i++) {
+		j9mem_free_memory(caches->caches[i].table.buckets);
+		j9mem_free_memory(caches->caches[i].chains);
+	}
+	j9mem_free_memory(caches->methods);
+	j9mem_free_memory(caches->memory);
+}
+
+/**
+ * Fill a synthetic stack with one JIT return address per frame, spread over all the compiled methods.
+ */
+void
+fillJitLookStack(JitLookCodeCaches *caches, UDATA *stack, UDATA depth)
+{
+	UDATA i = 0;
+
+	for (i = 0; i < depth; i++) {
+		UDATA hash = hashIndex(i);
+		J9JITExceptionTable *method = &caches->methods[(hash >> 8) % caches->methodCount];
+		stack[i] = method->startPC + ((hash >> 4) % (method->endPC - method->startPC));
+	}
+}
+
+/**
+ * The lookup jit_artifact_search() did before it walked the code cache tree itself.
+ */
+J9JITExceptionTable *
+jitLookReferenceSearch(J9AVLTree *tree, UDATA pc)
+{
+	J9JITHashTable *table = (J9JITHashTable *)avl_search(tree, pc);
+	if (NULL != table) {
+		return hash_jit_artifact_search(table, pc);
+	}
+	return NULL;
+}
+
+/**
+ * Hash of an index, used to vary method sizes and stack frames without any state,
+ * so every run builds the same caches.
+ */
+static UDATA
+hashIndex(UDATA index)
+{
+	U_32 hash = (U_32)index * 2654435761U;
+	hash ^= hash >> 15;
+	hash *= 0x85EBCA6BU;
+	hash ^= hash >> 13;
+	return (UDATA)hash;
+}
+
+static IDATA
+insertionCompare(J9AVLTree *tree, J9JITHashTable *insertNode, J9JITHashTable *walkNode)
+{
+	if (walkNode->start > insertNode->start) {
+		return 1;
+	} else if (walkNode->start < insertNode->start) {
+		return -1;
+	}
+	return 0;
+}
+
+static IDATA
+searchCompare(J9AVLTree *tree, UDATA searchValue, J9JITHashTable *walkNode)
+{
+	if (searchValue >= walkNode->end) {
+		return -1;
+	}
+	if (searchValue < walkNode->start) {
+		return 1;
+	}
+	return 0;
+}
+
+/**
+ * Lay out methods of varying size, separated by small gaps, from the start of the cache until it is
+ * nearly full, and fill the buckets the way hash_jit_artifact_insert_range() does: a single tagged
+ * metadata pointer, or a chain of pointers whose last entry is tagged.
+ * @return the number of methods placed, or 0 on allocation failure
+ */
+static UDATA
+populateCodeCache(J9PortLibrary *portLib, JitLookCodeCache *cache, UDATA start, J9JITExceptionTable *methods, UDATA salt)
+{
+	UDATA bucketCount = JITLOOK_CODE_CACHE_SIZE >> JITLOOK_BUCKET_SHIFT;
+	UDATA methodCount = 0;
+	UDATA chainAllocate = 0;
+	UDATA pc = start;
+	UDATA firstMethod = 0;
+	UDATA bucket = 0;
+	PORT_ACCESS_FROM_PORT(portLib);
+
+	cache->table.start = start;
+	cache->table.end = start + JITLOOK_CODE_CACHE_SIZE;
+	cache->table.buckets = j9mem_allocate_memory(bucketCount * sizeof(UDATA), OMRMEM_CATEGORY_JIT);
+	cache->chains = j9mem_allocate_memory(((JITLOOK_CODE_CACHE_SIZE / 64) + bucketCount) * sizeof(UDATA), OMRMEM_CATEGORY_JIT);
+	if ((NULL == cache->table.buckets) || (NULL == cache->chains)) {
+		return 0;
+	}
+	memset(cache->table.buckets, 0, bucketCount * sizeof(UDATA));
+
+	for (;;) {
+		UDATA hash = hashIndex((salt << 16) + methodCount);
+		/* mostly small methods, so many buckets are shared, with the occasional large one */
+		UDATA size = 64 + (((hash >> 8) % 16) * 32);
+		if (0 == ((hash >> 12) % 8)) {
+			size += ((hash >> 16) % 64) * 64;
+		}
+		if ((pc + size + 64) > cache->table.end) {
+			break;
+		}
+		methods[methodCount].startPC = pc;
+		methods[methodCount].endWarmPC = pc + size;
+		methods[methodCount].endPC = pc + size;
+		methodCount += 1;
+		pc += size + ((hash >> 24) % 4) * 16;
+	}
+
+	for (bucket = 0; bucket < bucketCount; bucket++) {
+		UDATA bucketStart = start + (bucket << JITLOOK_BUCKET_SHIFT);
+		UDATA bucketEnd = bucketStart + ((UDATA)1 << JITLOOK_BUCKET_SHIFT);
+		UDATA *chain = cache->chains + chainAllocate;
+		UDATA chainLength = 0;
+		UDATA m = 0;
+
+		while ((firstMethod < methodCount) && (methods[firstMethod].endPC <= bucketStart)) {
+			firstMethod += 1;
+		}
+		for (m = firstMethod; (m < methodCount) && (methods[m].startPC < bucketEnd); m++) {
+			chain[chainLength] = (UDATA)&methods[m];
+			chainLength += 1;
+		}
+		if (1 == chainLength) {
+			cache->table.buckets[bucket] = chain[0] | 1;
+		} else if (chainLength > 1) {
+			chain[chainLength - 1] |= 1;
+			cache->table.buckets[bucket] = (UDATA)chain;
+			chainAllocate += chainLength;
+		}
+	}
+
+	return methodCount;
+}
+
+#endif /* J9VM_INTERP_NATIVE_SUPPORT */
@@ -0,0 +1,96 @@
+/*******************************************************************************
+ * Copyright (c) 2017, 2017 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ *******************************************************************************/
+
+/*
+ * Times walks of a deep synthetic stack of JIT return addresses with jit_artifact_search() and with
+ * the avl_search() based lookup it replaced. This is a measurement, not a test: it is built as its
+ * own executable so that the algotest sanity run stays deterministic.
+ */
+
+#include "j9protos.h"
+#include "j9port.h"
+#include "exelib_api.h"
+#include "util_api.h"
+#include "algorithm_test_internal.h"
+
+#define JITLOOK_STACK_DEPTH 4096
+#define JITLOOK_BENCHMARK_WALKS 256
+
+UDATA
+signalProtectedMain(struct J9PortLibrary *portLibrary, void *arg)
+{
+#if defined(J9VM_INTERP_NATIVE_SUPPORT)
+	JitLookCodeCaches caches;
+	UDATA *stack = NULL;
+	UDATA i = 0;
+	UDATA walk = 0;
+	UDATA found = 0;
+	U_64 startTime = 0;
+	U_64 referenceTime = 0;
+	U_64 searchTime = 0;
+	UDATA rc = 0;
+	PORT_ACCESS_FROM_PORT(portLibrary);
+
+	stack = j9mem_allocate_memory(JITLOOK_STACK_DEPTH * sizeof(UDATA), OMRMEM_CATEGORY_JIT);
+	if ((0 != allocateJitLookCodeCaches(PORTLIB, &caches)) || (NULL == stack)) {
+		j9tty_err_printf(PORTLIB, "Unable to allocate JIT artifact search benchmark memory\n");
+		rc = 1;
+		goto done;
+	}
+	fillJitLookStack(&caches, stack, JITLOOK_STACK_DEPTH);
+
+	startTime = j9time_hires_clock();
+	for (walk = 0; walk < JITLOOK_BENCHMARK_WALKS; walk++) {
+		for (i = 0; i < JITLOOK_STACK_DEPTH; i++) {
+			if (NULL != jitLookReferenceSearch(&caches.tree, stack[i])) {
+				found += 1;
+			}
+		}
+	}
+	referenceTime = j9time_hires_delta(startTime, j9time_hires_clock(), J9PORT_TIME_DELTA_IN_MICROSECONDS);
+
+	startTime = j9time_hires_clock();
+	for (walk = 0; walk < JITLOOK_BENCHMARK_WALKS; walk++) {
+		for (i = 0; i < JITLOOK_STACK_DEPTH; i++) {
+			if (NULL != jit_artifact_search(&caches.tree, stack[i])) {
+				found -= 1;
+			}
+		}
+	}
+	searchTime = j9time_hires_delta(startTime, j9time_hires_clock(), J9PORT_TIME_DELTA_IN_MICROSECONDS);
+
+	if (0 != found) {
+		/* algotest reports the details, a mismatch only invalidates the timings here */
+		j9tty_err_printf(PORTLIB, "avl_search and jit_artifact_search resolved a different number of frames\n");
+		rc = 1;
+	}
+
+	j9tty_printf(PORTLIB, "Walk of %u JIT frames x %u over %zu methods: avl_search %llu usec, jit_artifact_search %llu usec\n",
+			JITLOOK_STACK_DEPTH, JITLOOK_BENCHMARK_WALKS, caches.methodCount, referenceTime, searchTime);
+
+done:
+	freeJitLookCodeCaches(PORTLIB, &caches);
+	j9mem_free_memory(stack);
+	return rc;
+#else /* J9VM_INTERP_NATIVE_SUPPORT */
+	return 0;
+#endif /* J9VM_INTERP_NATIVE_SUPPORT */
+}
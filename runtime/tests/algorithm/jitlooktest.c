@@ -0,0 +1,95 @@
+/*******************************************************************************
+ * Copyright (c) 2017, 2017 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ *******************************************************************************/
+
+#include "j9protos.h"
+#include "j9port.h"
+#include "util_api.h"
+#include "algorithm_test_internal.h"
+
+#if defined(J9VM_INTERP_NATIVE_SUPPORT)
+
+/**
+ * Check that jit_artifact_search() finds the right metadata for PCs inside methods and nothing for
+ * PCs in the gaps between them, comparing every byte of the fake code caches built by
+ * allocateJitLookCodeCaches() with the avl_search() based lookup it used to do.
+ */
+I_32
+verifyJitArtifactSearch(J9PortLibrary *portLib, UDATA *passCount, UDATA *failCount)
+{
+	JitLookCodeCaches caches;
+	UDATA i = 0;
+	UDATA found = 0;
+	UDATA mismatches = 0;
+	I_32 rc = 0;
+	PORT_ACCESS_FROM_PORT(portLib);
+
+	j9tty_printf(PORTLIB, "Testing JIT artifact search...\n");
+
+	if (0 != allocateJitLookCodeCaches(PORTLIB, &caches)) {
+		j9tty_err_printf(PORTLIB, "Unable to allocate JIT artifact search test memory\n");
+		(*failCount)++;
+		rc = -1;
+		goto done;
+	}
+
+	/* every byte of every cache, including the gaps between methods and the unused tail */
+	for (i = 0; i < (JITLOOK_CODE_CACHES * JITLOOK_CODE_CACHE_SIZE); i++) {
+		UDATA pc = (UDATA)caches.memory + i;
+		J9JITExceptionTable *expected = jitLookReferenceSearch(&caches.tree, pc);
+		J9JITExceptionTable *result = jit_artifact_search(&caches.tree, pc);
+		if ((expected != result)
+			|| ((NULL != result) && ((pc < result->startPC) || (pc >= result->endPC)))
+		) {
+			mismatches += 1;
+		}
+		if (NULL != result) {
+			found += 1;
+		}
+	}
+	/* addresses outside every cache */
+	if ((NULL != jit_artifact_search(&caches.tree, (UDATA)caches.memory - 1))
+		|| (NULL != jit_artifact_search(&caches.tree, (UDATA)caches.memory + (JITLOOK_CODE_CACHES * JITLOOK_CODE_CACHE_SIZE)))
+	) {
+		mismatches += 1;
+	}
+	if ((0 != mismatches) || (0 == found)) {
+		j9tty_err_printf(PORTLIB, "JIT artifact search found %zu mismatches (%zu PCs resolved)\n", mismatches, found);
+		(*failCount)++;
+	} else {
+		(*passCount)++;
+	}
+
+	j9tty_printf(PORTLIB, "Finished testing JIT artifact search.\n");
+
+done:
+	freeJitLookCodeCaches(PORTLIB, &caches);
+	return rc;
+}
+
+#else /* J9VM_INTERP_NATIVE_SUPPORT */
+
+I_32
+verifyJitArtifactSearch(J9PortLibrary *portLib, UDATA *passCount, UDATA *failCount)
+{
+	return 0;
+}
+
+#endif /* J9VM_INTERP_NATIVE_SUPPORT */
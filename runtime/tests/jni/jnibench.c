@@ -3701,6 +3701,30 @@ void JNICALL Java_jit_test_vich_JNILocalRef_localReference32(JNIEnv *env, jobjec
 }
 
 
+void JNICALL Java_jit_test_vich_JNIGlobalRef_globalReferenceChurn(JNIEnv *env, jobject obj, jobject o1, jint loopCount)
+{
+	jint i, j;
+	jobject globalRefs[8];
+	jweak weakRefs[8];
+
+	/* called from many threads at once to measure contention on the global reference pools */
+	for (i = 0; i < loopCount; i++)
+	{
+		for (j = 0; j < 8; j++)
+		{
+			globalRefs[j] = (*env)->NewGlobalRef(env, o1);
+			weakRefs[j] = (*env)->NewWeakGlobalRef(env, o1);
+		}
+		for (j = 0; j < 8; j++)
+		{
+			(*env)->DeleteGlobalRef(env, globalRefs[j]);
+			(*env)->DeleteWeakGlobalRef(env, weakRefs[j]);
+		}
+	}
+	return;
+}
+
+
 void JNICALL Java_jit_test_vich_JNIObjectArray_getObjectArrayElement(JNIEnv *env, jobject obj, jobjectArray array, jobjectArray blankArray, jint arraySize, jint loopCount)
 {
 	jint i, j;
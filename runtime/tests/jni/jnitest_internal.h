@@ -153,6 +153,17 @@ Java_j9vm_test_monitor_Helpers_monitorExitWithException(JNIEnv * env, jclass cla
 void JNICALL 
 Java_j9vm_test_monitor_Helpers_monitorReserve(JNIEnv * env, jclass clazz, jobject obj);
 
+/**
+* @brief
+* @param *env
+* @param clazz
+* @param objects
+* @param iterations
+* @return jint
+*/
+jint JNICALL
+Java_j9vm_test_monitor_Helpers_monitorTableContention(JNIEnv * env, jclass clazz, jobjectArray objects, jint iterations);
+
 
 /* ---------------- jnibench.c ---------------- */
 
@@ -1733,6 +1744,18 @@ void JNICALL
 Java_jit_test_vich_JNIObjectArray_getObjectArrayElement(JNIEnv *env, jobject obj, jobjectArray array, jobjectArray blankArray, jint arraySize, jint loopCount);
 
 
+/**
+* @brief
+* @param *env
+* @param obj
+* @param o1
+* @param loopCount
+* @return void
+*/
+void JNICALL 
+Java_jit_test_vich_JNIGlobalRef_globalReferenceChurn(JNIEnv *env, jobject obj, jobject o1, jint loopCount);
+
+
 /* ---------------- jnitest.c ---------------- */
 
 /**
@@ -101,3 +101,49 @@ Java_j9vm_test_monitor_Helpers_monitorReserve(JNIEnv * env, jclass clazz, jobjec
 
 
 
+
+#define MONTEST_MAX_CONTENTION_OBJECTS 64
+
+/**
+ * Enter and exit the monitor of each object in objects, iterations times over.
+ * Run from several threads at once on objects which have no lockword (such as arrays)
+ * to measure contention on monitor table lookups.
+ *
+ * @return 0 on success, otherwise the failing return code
+ */
+jint JNICALL
+Java_j9vm_test_monitor_Helpers_monitorTableContention(JNIEnv * env, jclass clazz, jobjectArray objects, jint iterations)
+{
+	jobject refs[MONTEST_MAX_CONTENTION_OBJECTS];
+	jsize count = (*env)->GetArrayLength(env, objects);
+	jint rc = 0;
+	jint i = 0;
+	jsize j = 0;
+
+	if (count > MONTEST_MAX_CONTENTION_OBJECTS) {
+		count = MONTEST_MAX_CONTENTION_OBJECTS;
+	}
+	if (0 != (*env)->PushLocalFrame(env, count)) {
+		return JNI_ENOMEM;
+	}
+	for (j = 0; j < count; j++) {
+		refs[j] = (*env)->GetObjectArrayElement(env, objects, j);
+	}
+
+	for (i = 0; i < iterations; i++) {
+		for (j = 0; j < count; j++) {
+			rc = (*env)->MonitorEnter(env, refs[j]);
+			if (0 != rc) {
+				goto done;
+			}
+			rc = (*env)->MonitorExit(env, refs[j]);
+			if (0 != rc) {
+				goto done;
+			}
+		}
+	}
+
+done:
+	(*env)->PopLocalFrame(env, NULL);
+	return rc;
+}
@@ -44,6 +44,7 @@ class CompositeCacheTest {
 		static IDATA createTest(J9JavaVM* vm, IDATA testCacheSize, SH_CompositeCacheImpl** cc1, SH_CompositeCacheImpl** cc1a, SH_CompositeCacheImpl** cc2, SH_CompositeCacheImpl** cc2a, U_64 *runtimeFlags0, U_64 *runtimeFlags1);
 		static IDATA allocateAndStats(J9JavaVM* vm, IDATA testCacheSize, SH_CompositeCacheImpl* cc1, SH_CompositeCacheImpl* cc1a);
 		static IDATA basicMutexTest(J9JavaVM* vm, SH_CompositeCacheImpl* cc1, SH_CompositeCacheImpl* cc1a);
+		static IDATA readerSlotTest(J9JavaVM* vm, SH_CompositeCacheImpl* cc1, SH_CompositeCacheImpl* cc1a);
 		static IDATA updateTest(J9JavaVM* vm, IDATA testCacheSize, SH_CompositeCacheImpl* cc1, SH_CompositeCacheImpl* cc1a);
 		static IDATA writeHashTest(J9JavaVM* vm, IDATA testCacheSize, SH_CompositeCacheImpl* cc1, SH_CompositeCacheImpl* cc1a);
 		static IDATA crashCntrTest(J9JavaVM* vm, SH_CompositeCacheImpl* cc1, SH_CompositeCacheImpl* cc1a);
@@ -483,6 +484,54 @@ CompositeCacheTest::basicMutexTest(J9JavaVM* vm, SH_CompositeCacheImpl* cc1, SH_
 	return PASS;
 }
 
+IDATA
+CompositeCacheTest::readerSlotTest(J9JavaVM* vm, SH_CompositeCacheImpl* cc1, SH_CompositeCacheImpl* cc1a)
+{
+	/* Readers registered in a reader slot are counted by every view of the cache */
+	if (!cc1->enterReaderSlot(vm->mainThread)) {
+		return 1;
+	}
+	if (!cc1a->enterReaderSlot(vm->mainThread)) {
+		return 2;
+	}
+	if (cc1->getReaderCount(vm->mainThread) != 2) {
+		return 3;
+	}
+	cc1->exitReaderSlot(vm->mainThread);
+	cc1a->exitReaderSlot(vm->mainThread);
+	if (cc1a->getReaderCount(vm->mainThread) != 0) {
+		return 4;
+	}
+
+	/* Readers must not register while the cache is locked */
+	if (cc1->enterWriteMutex(vm->mainThread, true, "")) {
+		return 5;
+	}
+	if (cc1a->enterReaderSlot(vm->mainThread)) {
+		return 6;
+	}
+	if (cc1->getReaderCount(vm->mainThread) != 0) {
+		return 7;
+	}
+	if (cc1->exitWriteMutex(vm->mainThread, "")) {
+		return 8;
+	}
+
+	/* Taking the write mutex without locking the cache does not exclude readers */
+	if (cc1->enterWriteMutex(vm->mainThread, false, "")) {
+		return 9;
+	}
+	if (!cc1a->enterReaderSlot(vm->mainThread)) {
+		return 10;
+	}
+	cc1a->exitReaderSlot(vm->mainThread);
+	if (cc1->exitWriteMutex(vm->mainThread, "")) {
+		return 11;
+	}
+
+	return PASS;
+}
+
 IDATA 
 CompositeCacheTest::checkUpdateResults(J9JavaVM* vm, SH_CompositeCacheImpl* cc, UDATA expectedCheckUpdates, bool tryNextEntry, char* expectedNextEntry, 
 			bool useStaleItems, UDATA expectedStale, bool expectSegment, char* segment)
@@ -1032,6 +1081,7 @@ testCompositeCache(J9JavaVM* vm)
 	SHC_TEST_ASSERT("createTest", CompositeCacheTest::createTest(vm, testCacheSize, &testCache1, &testCache1a, &testCache2, &testCache2a, &runtimeFlags0, &runtimeFlags1), success, rc);
 	SHC_TEST_ASSERT("allocateAndStats", CompositeCacheTest::allocateAndStats(vm, testCacheSize, testCache1, testCache1a), success, rc);
 	SHC_TEST_ASSERT("basicMutexTest", CompositeCacheTest::basicMutexTest(vm, testCache1, testCache1a), success, rc);
+	SHC_TEST_ASSERT("readerSlotTest", CompositeCacheTest::readerSlotTest(vm, testCache1, testCache1a), success, rc);
 	/* use testCache2 and testCache2a because 1 and 1a have now got stuff in */
 	SHC_TEST_ASSERT("updateTest", CompositeCacheTest::updateTest(vm, testCacheSize, testCache2, testCache2a), success, rc);
 	/* TODO: Test made temporarily invalid by static _vmID
@@ -231,7 +231,7 @@ done:
 
 
 IDATA
-OpenCacheHelper::closeTestCache(bool freeCache)
+OpenCacheHelper::closeTestCache(bool freeCache, bool destroyCache)
 {
 	SH_CacheMap *cachemap;
 	IDATA rc = PASS;
@@ -249,7 +249,7 @@ OpenCacheHelper::closeTestCache(bool freeCache)
 		j9mem_free_memory(cachemap);
 	}
 
-	if (false == inMemoryCache) {
+	if ((false == inMemoryCache) && destroyCache) {
 		rc = j9shr_destroySharedCache(vm, cacheDir, cacheName, cacheType, false);
 	}
 
@@ -273,7 +273,7 @@ OpenCacheHelper::closeTestCache(bool freeCache)
 		piConfig = NULL;
 	}
 
-	if ((inMemoryCache == false) && (J9SH_DESTROYED_ALL_CACHE != rc)) {
+	if ((inMemoryCache == false) && destroyCache && (J9SH_DESTROYED_ALL_CACHE != rc)) {
 		ERRPRINTF("Failed to destroy corrupt cache\n");
 		j9tty_printf(PORTLIB, "\tj9shr_destroySharedCache()=%d\n", rc);
 		rc = FAIL;
@@ -64,7 +64,7 @@ public:
 			bool doCleanupOnFail=true,
 			J9SharedClassPreinitConfig* cacheDetails=0,
 			J9SharedClassConfig* sharedclassconfig=0);
-	IDATA closeTestCache(bool freeCache);
+	IDATA closeTestCache(bool freeCache, bool destroyCache = true);
 	IDATA addDummyROMClass(const char *romClassName, U_32 dummyROMClassSize = 4096);
 	void setRomClassName(J9ROMClass * rc, const char * name);
 	OpenCacheHelper(J9JavaVM* vm)
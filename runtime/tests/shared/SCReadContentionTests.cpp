@@ -0,0 +1,209 @@
+/*******************************************************************************
+ * Copyright (c) 2017, 2017 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+extern "C"
+{
+#include "shrinit.h"
+}
+#include "OpenCacheHelper.h"
+#include "hookhelpers.hpp"
+#include "ProcessHelper.h"
+
+#define READCONTENTION_CACHE_NAME "shrtestreadcontention"
+#define READCONTENTION_LAUNCH_SEMAPHORE "testSCReadContention"
+#define READCONTENTION_NUM_PROCESSES 4
+#define READCONTENTION_NUM_CLASSES 64
+#define READCONTENTION_NUM_LOOKUPS 1024
+#define READCONTENTION_CLASS_NAME_LENGTH 32
+
+extern "C"
+{
+	IDATA testSCReadContention(J9JavaVM* vm, struct j9cmdlineOptions *arg, UDATA child);
+}
+
+/**
+ * Simulates many JVMs starting at once against one cache. The parent populates a persistent cache
+ * with dummy ROMClasses, then releases several child processes together. Each child attaches to the
+ * cache and repeatedly looks the classes up through SH_CacheMap::findROMClass() while the others are
+ * registered as readers, and fails if any class is not found.
+ */
+class SCReadContentionTest : public OpenCacheHelper {
+public:
+	SCReadContentionTest(J9JavaVM* vm) : OpenCacheHelper(vm) {}
+
+	IDATA populateCache(void);
+	IDATA checkLookups(void);
+
+private:
+	void getClassName(UDATA index, char *buffer);
+};
+
+void
+SCReadContentionTest::getClassName(UDATA index, char *buffer)
+{
+	PORT_ACCESS_FROM_JAVAVM(vm);
+
+	j9str_printf(PORTLIB, buffer, READCONTENTION_CLASS_NAME_LENGTH, "ReadContentionClass%zu", index);
+}
+
+IDATA
+SCReadContentionTest::populateCache(void)
+{
+	char className[READCONTENTION_CLASS_NAME_LENGTH];
+	IDATA rc = PASS;
+
+	for (UDATA i = 0; i < READCONTENTION_NUM_CLASSES; i++) {
+		getClassName(i, className);
+		rc = addDummyROMClass(className);
+		if (PASS != rc) {
+			break;
+		}
+	}
+	return rc;
+}
+
+IDATA
+SCReadContentionTest::checkLookups(void)
+{
+	const char *testName = "checkLookups";
+	char className[READCONTENTION_CLASS_NAME_LENGTH];
+	J9ClassPathEntry cpEntry;
+	ClasspathItem *cpi = NULL;
+	const char *currentDir = ".";
+	IDATA rc = PASS;
+	PORT_ACCESS_FROM_JAVAVM(vm);
+
+	/* create dummy class path item to pass to findROMClass() */
+	memset(&cpEntry, 0, sizeof(J9ClassPathEntry));
+	cpEntry.path = (U_8 *)currentDir;
+	cpEntry.extraInfo = NULL;
+	cpEntry.pathLength = 1;
+	cpEntry.type = CPE_TYPE_DIRECTORY;
+
+	cpi = createClasspath(vm->mainThread, &cpEntry, 1, 0, CP_TYPE_CLASSPATH, 0);
+	if (NULL == cpi) {
+		ERRPRINTF("failed to create dummy classpath\n");
+		return FAIL;
+	}
+
+	for (UDATA i = 0; i < READCONTENTION_NUM_LOOKUPS; i++) {
+		getClassName(i % READCONTENTION_NUM_CLASSES, className);
+		cacheMap->enterLocalMutex(vm->mainThread, vm->classMemorySegments->segmentMutex, "class segment mutex", testName);
+		if (NULL == cacheMap->findROMClass(vm->mainThread, className, cpi, NULL, NULL, -1, NULL)) {
+			ERRPRINTF1("failed to find %s\n", className);
+			rc = FAIL;
+		}
+		cacheMap->exitLocalMutex(vm->mainThread, vm->classMemorySegments->segmentMutex, "class segment mutex", testName);
+		if (PASS != rc) {
+			break;
+		}
+	}
+	return rc;
+}
+
+extern "C" {
+
+IDATA
+testSCReadContention(J9JavaVM* vm, struct j9cmdlineOptions *arg, UDATA child)
+{
+	const char *testName = "testSCReadContention";
+	SCReadContentionTest test(vm);
+	J9ProcessHandle pid[READCONTENTION_NUM_PROCESSES];
+	char * childargv[SHRTEST_MAX_CMD_OPTS];
+	UDATA childargc = 0;
+	IDATA semhandle = -1;
+	IDATA rc = PASS;
+	PORT_ACCESS_FROM_JAVAVM(vm);
+
+	semhandle = openLaunchSemaphore(PORTLIB, READCONTENTION_LAUNCH_SEMAPHORE, READCONTENTION_NUM_PROCESSES);
+	if (-1 == semhandle) {
+		ERRPRINTF("cannot open launch control semaphores\n");
+		return FAIL;
+	}
+
+	if (child) {
+		WaitForLaunchSemaphore(PORTLIB, semhandle);
+		CloseLaunchSemaphore(PORTLIB, semhandle);
+
+		if (PASS != test.openTestCache(J9PORT_SHR_CACHE_TYPE_PERSISTENT, CACHE_SIZE, READCONTENTION_CACHE_NAME, false, NULL)) {
+			ERRPRINTF("child failed to attach to the cache\n");
+			return FAIL;
+		}
+		rc = test.checkLookups();
+		/* the parent owns the cache and destroys it once every child has finished */
+		test.closeTestCache(true, false);
+		return rc;
+	}
+
+	REPORT_START("SCReadContention");
+
+	if (PASS != test.openTestCache(J9PORT_SHR_CACHE_TYPE_PERSISTENT, CACHE_SIZE, READCONTENTION_CACHE_NAME, false, NULL)) {
+		ERRPRINTF("failed to create the cache\n");
+		CloseLaunchSemaphore(PORTLIB, semhandle);
+		return FAIL;
+	}
+
+	if (PASS != test.populateCache()) {
+		ERRPRINTF("failed to add dummy ROMClasses\n");
+		rc = FAIL;
+		goto done;
+	}
+
+	if (PASS != test.checkLookups()) {
+		rc = FAIL;
+		goto done;
+	}
+
+	childargc = buildChildCmdlineOption(arg->argc, arg->argv, READCONTENTIONTEST_CMDLINE_STARTSWITH, childargv);
+	for (UDATA i = 0; i < READCONTENTION_NUM_PROCESSES; i++) {
+		pid[i] = LaunchChildProcess(PORTLIB, testName, childargv, childargc);
+		if (NULL == pid[i]) {
+			ERRPRINTF("failed to launch child process\n");
+			/* release the children that were launched so they do not wait forever */
+			ReleaseLaunchSemaphore(PORTLIB, semhandle, READCONTENTION_NUM_PROCESSES);
+			for (UDATA j = 0; j < i; j++) {
+				WaitForTestProcess(PORTLIB, pid[j]);
+			}
+			rc = FAIL;
+			goto done;
+		}
+	}
+
+	/* Let all the children start together */
+	ReleaseLaunchSemaphore(PORTLIB, semhandle, READCONTENTION_NUM_PROCESSES);
+
+	for (UDATA i = 0; i < READCONTENTION_NUM_PROCESSES; i++) {
+		if (0 != WaitForTestProcess(PORTLIB, pid[i])) {
+			ERRPRINTF1("child process %zu reported failure\n", i);
+			rc = FAIL;
+		}
+	}
+
+done:
+	CloseLaunchSemaphore(PORTLIB, semhandle);
+	if (PASS != test.closeTestCache(true)) {
+		rc = FAIL;
+	}
+	REPORT_SUMMARY("SCReadContention", rc);
+	return rc;
+}
+
+} /* extern "C" */
@@ -70,6 +70,7 @@ IDATA testProtectNewROMClassData(J9JavaVM* vm);
 IDATA testCacheDirPerm(J9JavaVM *vm);
 IDATA testCacheFull(J9JavaVM *vm);
 IDATA testProtectSharedCacheData(J9JavaVM *vm);
+IDATA testSCReadContention(J9JavaVM* vm, struct j9cmdlineOptions *arg, UDATA child);
 
 UDATA
 buildChildCmdlineOption(int argc, char **argv, const char *options, char * newargv[SHRTEST_MAX_CMD_OPTS]) {
@@ -247,6 +248,21 @@ signalProtectedMain(struct J9PortLibrary *portLibrary, void * vargs)
 		}
 #endif
 
+		if (startsWith(argv[i],READCONTENTIONTEST_CMDLINE_STARTSWITH)!=0) {
+			IDATA procrc = 1;
+			if (createJavaVM(args, &vm, FALSE, FALSE, &env) != JNI_OK) {
+				j9tty_printf(PORTLIB,"\nCound not create jvm for testSCReadContention. Exiting unit test...\n");
+				return procrc;
+			}
+
+			procrc = testSCReadContention(vm, args, TRUE);
+
+			if ( (*((JavaVM*)vm))->DestroyJavaVM((JavaVM*)vm) != JNI_OK ) {
+				args->shutdownPortLib = FALSE;
+			}
+			return procrc;
+		}
+
 		if(startsWith(argv[i],OSCACHETEST_CMDLINE_STARTSWITH)!=0) {
 			IDATA procrc = 1;
 			if (createJavaVM(args, &vm, FALSE, FALSE, &env) != JNI_OK) {
@@ -325,6 +341,9 @@ signalProtectedMain(struct J9PortLibrary *portLibrary, void * vargs)
 	HEADING(PORTLIB, "CorruptCache Test");
 	rc |= testCorruptCache(vm);
 
+	HEADING(PORTLIB, "SCReadContention Test");
+	rc |= testSCReadContention(vm, args, FALSE);
+
 	/* TODO: Temporarily disable AttachedDataTest and minmax tests on realtime */
 #if !defined(J9SHR_CACHELET_SUPPORT)
 	HEADING(PORTLIB, "AttachedData Test");
@@ -436,6 +455,10 @@ setupArguments(struct j9cmdlineOptions* startupOptions,JavaVMInitArgs* vm_args,v
 			/*go to next argument*/
 			continue;
 		}
+		if (startsWith(argv[counter],READCONTENTIONTEST_CMDLINE_STARTSWITH)!=0) {
+			/*go to next argument*/
+			continue;
+		}
 		if (vmOptionsTableAddOption(vmOptionsTable, argv[counter], NULL) != J9CMDLINE_OK) {
 
 			rc = FAIL;
@@ -30,6 +30,7 @@
 #define TRANSACTIONTEST_CMDLINE_STARTSWITH "-testSCStoreTransaction"
 #define TRANSACTION_WITHBCI_TEST_CMDLINE_STARTSWITH "-testSCStoreWithBCI"
 #define OSCACHETEST_CMDLINE_STARTSWITH "-sharedtestchild"
+#define READCONTENTIONTEST_CMDLINE_STARTSWITH "-testSCReadContention"
 
 #define JAVAHOMEDIR "-Djava.home="
 #define JAVAHOMEDIR_LEN strlen(JAVAHOMEDIR)
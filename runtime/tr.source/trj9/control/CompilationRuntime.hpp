@@ -556,7 +556,7 @@ public:
    TR_MethodToBeCompiled *addMethodToBeCompiled(TR::IlGeneratorMethodDetails &details, void *pc, CompilationPriority priority,
       bool async, TR_OptimizationPlan *optPlan, bool *queued, TR_YesNoMaybe methodIsInSharedCache);
 
-   void                   queueEntry(TR_MethodToBeCompiled *entry);
+   void                   queueEntry(TR_MethodToBeCompiled *entry, TR_MethodToBeCompiled *insertionHint = NULL);
    void                   recycleCompilationEntry(TR_MethodToBeCompiled *cur);
    TR_MethodToBeCompiled *adjustCompilationEntryAndRequeue(TR::IlGeneratorMethodDetails &details,
                                                            TR_PersistentMethodInfo *methodInfo,
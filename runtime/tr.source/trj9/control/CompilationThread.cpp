@@ -3906,6 +3906,7 @@ TR::CompilationInfo::addMethodToBeCompiled(TR::IlGeneratorMethodDetails & detail
 
    // Add this method to the queue of methods waiting to be compiled.
    TR_MethodToBeCompiled *cur = NULL, *prev = NULL;
+   TR_MethodToBeCompiled *insertionHint = NULL; // last entry that must stay in front of the new request
    uint32_t queueWeight = 0; // QW
    int32_t numEntries = 0;
 
@@ -3943,6 +3944,9 @@ TR::CompilationInfo::addMethodToBeCompiled(TR::IlGeneratorMethodDetails & detail
       queueWeight += cur->_weight;
       if (cur->getMethodDetails().sameAs(details, fe))
          break;
+      // Remember where the request belongs so that queueEntry does not need a second walk of the queue
+      if (cur->_priority >= priority)
+         insertionHint = cur;
       }
 
    // NOTE: we do not need to search the methodPool since we cannot reach here if an entry
@@ -4179,7 +4183,7 @@ TR::CompilationInfo::addMethodToBeCompiled(TR::IlGeneratorMethodDetails & detail
 
    // Move the entry to the right place in the queue
    //
-   queueEntry(cur);
+   queueEntry(cur, insertionHint);
 
    return cur;
    }
@@ -4187,14 +4191,25 @@ TR::CompilationInfo::addMethodToBeCompiled(TR::IlGeneratorMethodDetails & detail
 //--------------------------- queueEntry ---------------------------------
 // Insert the compilation request in the queue at the appropriate place
 // based on its priority. Must have compilationQueueMonitor in hanb
+// insertionHint, if not NULL, is a queued entry the caller found while
+// walking the queue; it is used directly if the new entry belongs right
+// after it, avoiding another walk of the (possibly long) queue
 //------------------------------------------------------------------------
-void TR::CompilationInfo::queueEntry(TR_MethodToBeCompiled *entry)
+void TR::CompilationInfo::queueEntry(TR_MethodToBeCompiled *entry, TR_MethodToBeCompiled *insertionHint)
    {
    TR_ASSERT_FATAL(entry->_freeTag & ENTRY_INITIALIZED, "queuing an entry which is not initialized\n");
 
    entry->_freeTag |= ENTRY_QUEUED;
 
-   if (!_methodQueue || _methodQueue->_priority < entry->_priority)
+   if (insertionHint &&
+       insertionHint != entry &&
+       insertionHint->_priority >= entry->_priority &&
+       (!insertionHint->_next || insertionHint->_next->_priority < entry->_priority))
+      {
+      entry->_next = insertionHint->_next;
+      insertionHint->_next = entry;
+      }
+   else if (!_methodQueue || _methodQueue->_priority < entry->_priority)
       {
       entry->_next = _methodQueue;
       _methodQueue = entry;
@@ -4097,6 +4097,13 @@ static void jitHookClassLoad(J9HookInterface * * hookInterface, UDATA eventNum,
 
    compInfo->getPersistentInfo()->getPersistentClassLoaderTable()->associateClassLoaderWithClass(classLoader, clazz);
 
+#if defined(J9VM_INTERP_PROFILING_BYTECODES)
+   // Pre-populate the IProfiler with profiles saved by a previous run (-Xjit:iprofilerPersistFile=)
+   TR_IProfiler *iProfiler = vm->getIProfiler();
+   if (iProfiler)
+      iProfiler->applyPersistedProfiles(cl->romClass);
+#endif
+
 #ifdef J9VM_JIT_NEW_INSTANCE_PROTOTYPE
    // Update the count for the newInstance
    //
@@ -4717,6 +4724,11 @@ void JitShutdown(J9JITConfig * jitConfig)
       // to track possible performance issues
       // iProfiler->dumpIPBCDataCallGraph(vmThread);
 
+      // Save branch and switch profiles for the next run
+      char *persistFileName = ((TR_JitPrivateConfig*)(jitConfig->privateConfig))->iprofilerPersistFileName;
+      if (persistFileName && vmThread)
+         iProfiler->dumpProfilesToFile(vmThread, persistFileName);
+
       // free the IProfiler structures
 
       // Dealllocate the buffers used for interpreter profiling
@@ -121,6 +121,7 @@ int32_t J9::Options::_iprofilerIntToTotalSampleRatio=2;
 int32_t J9::Options::_iprofilerSamplesBeforeTurningOff = 1000000; // samples
 int32_t J9::Options::_iprofilerNumOutstandingBuffers = 10;
 int32_t J9::Options::_iprofilerBufferMaxPercentageToDiscard = 0;
+int32_t J9::Options::_iprofilerBufferMaxPercentageToDiscardOnContention = 10;
 int32_t J9::Options::_iProfilerBufferInterarrivalTimeToExitDeepIdle = 5000; // 5 seconds
 int32_t J9::Options::_iprofilerBufferSize = 1024;
 #ifdef TR_HOST_64BIT
@@ -809,6 +810,9 @@ TR::OptionTable OMR::Options::_feOptions[] = {
    {"iprofilerBufferMaxPercentageToDiscard=", "O<nnn>\tpercentage of interpreter profiling buffers "
                                        "that JIT is allowed to discard instead of processing",
         TR::Options::setStaticNumeric, (intptrj_t)&TR::Options::_iprofilerBufferMaxPercentageToDiscard, 0, "F%d", NOT_IN_SUBSET},
+   {"iprofilerBufferMaxPercentageToDiscardOnContention=", "O<nnn>\tpercentage of interpreter profiling buffers "
+                                       "that JIT is allowed to discard when they cannot be handed to the iprofiler thread",
+        TR::Options::setStaticNumeric, (intptrj_t)&TR::Options::_iprofilerBufferMaxPercentageToDiscardOnContention, 0, "F%d", NOT_IN_SUBSET},
    {"iprofilerBufferSize=", "I<nnn>\t set the size of each iprofiler buffer",
         TR::Options::setStaticNumeric, (intptrj_t)&TR::Options::_iprofilerBufferSize, 0, " %d", NOT_IN_SUBSET},
    {"iprofilerFailHistorySize=", "I<nnn>\tNumber of entries for the failure history buffer maintained by Iprofiler",
@@ -830,6 +834,9 @@ TR::OptionTable OMR::Options::_feOptions[] = {
         TR::Options::setStaticNumeric, (intptrj_t)&TR::Options::_IprofilerOffDivisionFactor, 0, "F%d", NOT_IN_SUBSET},
    {"iprofilerOffSubtractionFactor=", "O<nnn>\tCounts Subtraction factor when IProfiler is Off",
         TR::Options::setStaticNumeric, (intptrj_t)&TR::Options::_IprofilerOffSubtractionFactor, 0, "F%d", NOT_IN_SUBSET},
+   {"iprofilerPersistFile=", "O<filename>\tread interpreter profiling data from <filename> at startup "
+                             "and write it back at shutdown",
+        TR::Options::setStringForPrivateBase, offsetof(TR_JitPrivateConfig,iprofilerPersistFileName), 0, "P%s"},
    {"iprofilerSamplesBeforeTurningOff=", "O<nnn>\tnumber of interpreter profiling samples "
                                 "needs to be taken after the profiling starts going off to completely turn it off. "
                                 "Specify a very large value to disable this optimization",
@@ -133,6 +133,7 @@ class OMR_EXTENSIBLE Options : public OMR::OptionsConnector
    static int32_t _iprofilerSamplesBeforeTurningOff;
    static int32_t _iprofilerNumOutstandingBuffers;
    static int32_t _iprofilerBufferMaxPercentageToDiscard;
+   static int32_t _iprofilerBufferMaxPercentageToDiscardOnContention;
    static int32_t _iProfilerBufferInterarrivalTimeToExitDeepIdle; // ms
    static int32_t _iprofilerBufferSize; //iprofilerbuffer size in kb
 
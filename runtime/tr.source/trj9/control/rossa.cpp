@@ -1461,6 +1461,11 @@ onLoadInternal(
          TR::Options::getCmdLineOptions()->setOption(TR_DisableInterpreterProfiling);
          // Warn that Interpreter Profiling was disabled
          }
+      else if (((TR_JitPrivateConfig*)(jitConfig->privateConfig))->iprofilerPersistFileName)
+         {
+         ((TR_JitPrivateConfig*)(jitConfig->privateConfig))->iProfiler->loadProfilesFromFile(
+            ((TR_JitPrivateConfig*)(jitConfig->privateConfig))->iprofilerPersistFileName);
+         }
       }
    else
       {
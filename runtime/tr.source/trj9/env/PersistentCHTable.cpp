@@ -583,8 +583,15 @@ TR_PersistentCHTable::dumpMethodCounts(TR_FrontEnd *fe, TR_Memory &trMemory)
 
 
 void
-TR_PersistentCHTable::resetVisitedClasses() // highly time consumming
+TR_PersistentCHTable::resetVisitedClasses()
    {
+   // Starting a new epoch clears every visited mark at once.  Only when the epoch counter
+   // wraps around do the classes have to be walked, so that marks from the previous use of
+   // the epoch value do not look current.
+   //
+   if (TR_PersistentClassInfo::startNewVisitEpoch())
+      return;
+
    for (int32_t i = 0; i <= CLASSHASHTABLE_SIZE; ++i)
       {
       TR_PersistentClassInfo * cl = _classes[i].getFirst();
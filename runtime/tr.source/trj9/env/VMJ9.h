@@ -125,6 +125,7 @@ typedef struct TR_JitPrivateConfig
    TR::FILE      *rtLogFile;
    char          *rtLogFileName;
    char          *itraceFileNamePrefix;
+   char          *iprofilerPersistFileName;
    TR_IProfiler  *iProfiler;
    TR_HWProfiler *hwProfiler;
    TR_LMGuardedStorage *lmGuardedStorage;
@@ -210,7 +210,7 @@ J9::Options::kcaOffsets(char *option, void *, TR::OptionTable *entry)
       fprintf( file, "#define J9JITSTACKATLAS_MAPBYTES   (%d)\n", offsetof(J9JITStackAtlas,numberOfMapBytes) );
       fprintf( file, "#define BODYINFO_HOTNESS           (%d)\n", offsetof(TR_PersistentJittedBodyInfo,_hotness) );
       fprintf( file, "#define PERSISTENTINFO_CHTABLE     (%d)\n", offsetof(TR::PersistentInfo,_persistentCHTable) );
-      fprintf( file, "#define PERSISTENTCLASS_VISITED    (%d)\n", offsetof(TR_PersistentClassInfo,_visitedStatus) );
+      fprintf( file, "#define PERSISTENTCLASS_VISITED    (%d)\n", 0 ); // The visited bit was replaced by TR_PersistentClassInfo::_visitEpoch
 
       fprintf( file, "#define ELS_OLDELS                 (%d)\n", offsetof(J9VMEntryLocalStorage,oldEntryLocalStorage) );
       fprintf( file, "#define ELS_I2JSTATE               (%d)\n", offsetof(J9VMEntryLocalStorage,i2jState) );
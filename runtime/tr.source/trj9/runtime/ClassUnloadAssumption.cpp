@@ -36,6 +36,20 @@
 
 extern TR::Monitor *assumptionTableMutex;
 
+uint16_t TR_PersistentClassInfo::_currentVisitEpoch = 1;
+
+bool
+TR_PersistentClassInfo::startNewVisitEpoch()
+   {
+   _currentVisitEpoch++;
+   if (_currentVisitEpoch != 0)
+      return true;
+
+   // 0 is reserved for classes that are not visited
+   _currentVisitEpoch = 1;
+   return false;
+   }
+
 void
 TR_PersistentClassInfo::setInitialized(TR_PersistentMemory * persistentMemory)
    {
@@ -149,6 +149,7 @@ TR_DataCacheManager::TR_DataCacheManager(J9JITConfig *jitConfig, TR::Monitor *mo
    {
    TR_ASSERT( (_quantumSize % sizeof(UDATA)) == 0, "Chunks need to be aligned with pointer size");
    TR_ASSERT( (_quantumSize * _minQuanta) >= sizeof(Allocation), "Allocation won't fit in free blocks" );
+   memset(_sizeClassBuckets, 0, sizeof(_sizeClassBuckets));
    // Add trace point if we have disabled reclamation
 #if defined(DATA_CACHE_DEBUG)
    if (!_newImplementation)
@@ -706,6 +707,14 @@ TR_DataCacheManager::addToPool(TR_DataCacheManager::Allocation *alloc)
 #if defined(DATA_CACHE_DEBUG) && (DATA_CACHE_VERBOSITY_LEVEL >= 3)
    fprintf(stderr, "Adding allocation to pool.  Start = %p, Size = %u\n", alloc, alloc->size());
 #endif
+   SizeBucket **sizeClassSlot = sizeClassBucketSlot(alloc->size());
+   if (sizeClassSlot && *sizeClassSlot)
+      {
+      (*sizeClassSlot)->push(alloc);
+      insertHook(alloc->size());
+      return;
+      }
+
    InPlaceList<SizeBucket>::Iterator it = _sizeList.begin();
    while (it != _sizeList.end() && it->size() < alloc->size() )
       {
@@ -723,6 +732,8 @@ TR_DataCacheManager::addToPool(TR_DataCacheManager::Allocation *alloc)
          {
          SizeBucket *sb = new ( vmAlloc ) SizeBucket(alloc);
          _sizeList.insert(it, *sb);
+         if (sizeClassSlot)
+            *sizeClassSlot = sb;
          insertHook(alloc->size());
          }
       else
@@ -740,14 +751,21 @@ TR_DataCacheManager::getFromPool(uint32_t size)
    fprintf(stderr, "Attempting to retrieve an allocation of size %u\n", size);
 #endif
    Allocation *ret = 0;
-   InPlaceList<SizeBucket>::Iterator it = _sizeList.begin();
-   while (it != _sizeList.end() && it->size() < size)
+   InPlaceList<SizeBucket>::Iterator it = _sizeList.end();
+   SizeBucket **sizeClassSlot = sizeClassBucketSlot(size);
+   if (sizeClassSlot && *sizeClassSlot)
       {
-      ++it;
+      // An exact fit, which is the bucket the walk below would stop at for both policies
+      it = InPlaceList<SizeBucket>::Iterator((*sizeClassSlot)->getListElement());
       }
-   if (it != _sizeList.end())
+   else
       {
-      if (_worstFit)
+      it = _sizeList.begin();
+      while (it != _sizeList.end() && it->size() < size)
+         {
+         ++it;
+         }
+      if (it != _sizeList.end() && _worstFit)
          {
          if (it->size() != size)
             {
@@ -755,12 +773,13 @@ TR_DataCacheManager::getFromPool(uint32_t size)
             --it;
             }
          }
+      }
+   if (it != _sizeList.end())
+      {
       ret = it->pop();
       if (it->isEmpty())
          {
-            SizeBucket *sb = &(*it);
-            _sizeList.remove(it);
-            freeMemoryToVM(sb);
+         removeSizeBucket(it);
          }
       }
    if (ret)
@@ -778,6 +797,20 @@ TR_DataCacheManager::getFromPool(uint32_t size)
    return ret;
    }
 
+void
+TR_DataCacheManager::removeSizeBucket(InPlaceList<SizeBucket>::Iterator bucket)
+   {
+   SizeBucket *sb = &(*bucket);
+   SizeBucket **sizeClassSlot = sizeClassBucketSlot(sb->size());
+   if (sizeClassSlot)
+      {
+      TR_ASSERT(*sizeClassSlot == sb, "Size class index out of step with the size list");
+      *sizeClassSlot = NULL;
+      }
+   _sizeList.remove(bucket);
+   freeMemoryToVM(sb);
+   }
+
 void
 TR_DataCacheManager::convertDataCachesToAllocations()
    {
@@ -1022,6 +1055,7 @@ TR_InstrumentedDataCacheManager::printStatistics()
    fprintf(stderr, "Bytes in pool = %zu\n", _bytesInPool);
    _allocationStatistics.report(stderr);
    _wasteStatistics.report(stderr);
+   printPoolFragmentation();
    printPoolContents();
    fflush(stderr);
    }
@@ -1036,6 +1070,31 @@ TR_InstrumentedDataCacheManager::printPoolContents()
       }
    }
 
+// Occupancy is the share of the space converted for JIT use that is currently allocated.
+// Fragmentation is the share of the free space lying outside the largest free block,
+// so it is 0% when all of the free space sits in a single block.
+void
+TR_InstrumentedDataCacheManager::printPoolFragmentation()
+   {
+   UDATA numBuckets = 0;
+   UDATA numFreeBlocks = 0;
+   UDATA largestFreeBlock = 0;
+   UDATA bytesInPool = 0;
+   for (InPlaceList<SizeBucket>::Iterator it = _sizeList.begin(); it != _sizeList.end(); ++it)
+      {
+      UDATA bucketSize = it->calculateBucketSize();
+      numBuckets++;
+      numFreeBlocks += bucketSize / it->size();
+      bytesInPool += bucketSize;
+      largestFreeBlock = it->size(); // the list is sorted by size
+      }
+   double occupancy = (_jitSpace != 0) ? (100.0 * _usedSpace / _jitSpace) : 0.0;
+   double fragmentation = (bytesInPool != 0) ? (100.0 * (bytesInPool - largestFreeBlock) / bytesInPool) : 0.0;
+   fprintf(stderr, "Occupancy = %.2f%%\n", occupancy);
+   fprintf(stderr, "Free blocks = %zu in %zu size buckets, largest = %zu bytes\n", numFreeBlocks, numBuckets, largestFreeBlock);
+   fprintf(stderr, "Fragmentation = %.2f%%\n", fragmentation);
+   }
+
 UDATA
 TR_InstrumentedDataCacheManager::calculatePoolSize()
    {
@@ -345,6 +345,7 @@ private:
    // Added as part of data cache reclamation
    void addToPool(Allocation *);
    Allocation *getFromPool(uint32_t size);
+   void removeSizeBucket(InPlaceList<SizeBucket>::Iterator bucket);
    Allocation *convertDataCacheToAllocation(TR_DataCache *dataCache);
    void *allocateMemoryFromVM(size_t size);
    void freeMemoryToVM(void *ptr);
@@ -357,6 +358,19 @@ private:
       return size;
       }
 
+   // Buckets holding sizes that are a whole number of quanta, indexed by that number. The
+   // requests reaching the pool are always rounded to quanta, so this turns the common exact
+   // size lookups into an array access instead of a walk of the sorted _sizeList.
+   enum { NumSizeClasses = 64 };
+   SizeBucket *_sizeClassBuckets[NumSizeClasses];
+   SizeBucket **sizeClassBucketSlot(uint32_t size)
+      {
+      uint32_t quanta = size / _quantumSize;
+      if ((size % _quantumSize) != 0 || quanta >= NumSizeClasses)
+         return NULL;
+      return &_sizeClassBuckets[quanta];
+      }
+
 protected:
 
    TR_DataCacheManager(J9JITConfig *jitConfig, TR::Monitor *monitor, uint32_t quantumSize, uint32_t minQuanta, bool newImplementation = true, bool worstFit = false);
@@ -437,6 +451,7 @@ protected:
 private:
    void printPoolContents();
    UDATA calculatePoolSize();
+   void printPoolFragmentation();
 
    UDATA _jitSpace;
    UDATA _freeSpace;
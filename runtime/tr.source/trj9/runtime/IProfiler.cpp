@@ -37,6 +37,7 @@
 #include "j9cfg.h"
 #include "rommeth.h"
 #include "vmaccess.h"
+#include "util_api.h"
 #include "control/Options.hpp"
 #include "control/Options_inlines.hpp"
 #include "compile/Compilation.hpp"
@@ -581,9 +582,10 @@ TR_IProfiler::TR_IProfiler(J9JITConfig *jitConfig)
    : _isIProfilingEnabled(true),
      _valueProfileMethod(NULL), _maxCount(DEFAULT_PROFILING_COUNT), _lightHashTableMonitor(0), _allowedToGiveInlinedInformation(true),
      _globalAllocationCount (0), _maxCallFrequency(0), _iprofilerThread(0), _iprofilerOSThread(NULL),
-     _workingBufferTail(NULL), _numOutstandingBuffers(0), _numRequests(1), _numRequestsSkipped(0),
-     _numRequestsHandedToIProfilerThread(0), _iprofilerThreadExitFlag(0), _iprofilerMonitor(NULL),
-     _crtProfilingBuffer(NULL), _iprofilerThreadAttachAttempted(false), _iprofilerNumRecords(0)
+     _workingBufferTail(NULL), _numOutstandingBuffers(0), _numRequests(1), _numRequestsSkipped(0), _numRequestsSkippedOnContention(0),
+     _numRequestsHandedToIProfilerThread(0), _numRequestsParsedByJavaThreads(0), _numBuffersParsedInBatch(0), _iprofilerThreadExitFlag(0), _iprofilerMonitor(NULL),
+     _crtProfilingBuffer(NULL), _iprofilerThreadAttachAttempted(false), _iprofilerNumRecords(0),
+     _persistedClasses(NULL), _numPersistedClasses(0), _numPersistedEntriesApplied(0)
    {
    PORT_ACCESS_FROM_JITCONFIG(jitConfig);
 
@@ -2630,10 +2632,15 @@ TR_IProfiler::outputStats()
       {
       fprintf(stderr, "IProfiler: Number of buffers to be processed           =%llu\n", _numRequests);
       fprintf(stderr, "IProfiler: Number of buffers discarded                 =%llu\n", _numRequestsSkipped);
+      fprintf(stderr, "IProfiler: Number of buffers discarded on contention   =%llu\n", _numRequestsSkippedOnContention);
       fprintf(stderr, "IProfiler: Number of buffers handed to iprofiler thread=%llu\n", _numRequestsHandedToIProfilerThread);
+      fprintf(stderr, "IProfiler: Number of buffers parsed by java threads    =%llu\n", _numRequestsParsedByJavaThreads);
+      fprintf(stderr, "IProfiler: Number of buffers parsed in a batch         =%llu\n", _numBuffersParsedInBatch);
       }
    fprintf(stderr, "IProfiler: Number of records processed=%llu\n", _iprofilerNumRecords);
    fprintf(stderr, "IProfiler: Number of hashtable entries=%u\n", countEntries());
+   if (_persistedClasses)
+      fprintf(stderr, "IProfiler: Number of entries applied from profile file=%u\n", _numPersistedEntriesApplied);
    checkMethodHashTable();
    }
 
@@ -3793,32 +3800,47 @@ bool TR_IProfiler::processProfilingBuffer(J9VMThread *vmThread, const U_8* dataS
    if (_numOutstandingBuffers >= TR::Options::_iprofilerNumOutstandingBuffers ||
        _compInfo->getPersistentInfo()->getLoadFactor() >= 1) // More active threads than CPUs
       {
-      if (100*_numRequestsSkipped >= (uint64_t)TR::Options::_iprofilerBufferMaxPercentageToDiscard * _numRequests)
+      if (!discardProfilingBuffer(vmThread, dataStart, false))
          {
          // too many skipped requests; let the java thread handle this one
-         //records = parseBuffer(vmThread, cursor, size, iProfiler);
-         //setProfilingBufferCursor(vmThread, (U_8*)cursor);
          return false; // delegate the processing to the java thread
          }
-      else // skip this request altogether
-         {
-         _numRequestsSkipped++;
-         setProfilingBufferCursor(vmThread, (U_8*)dataStart);
-         }
       }
    else // The iprofilerThread will handle this request
       {
       if (!postIprofilingBufferToWorkingQueue(vmThread, dataStart, size))
          {
-         // If posting fails, we should let the app thread process the buffer
-         return false;
-         //_numRequestsSkipped++;
-         //setProfilingBufferCursor(vmThread, (U_8*)dataStart);
+         // The iprofiler thread could not take the buffer, typically because another
+         // java thread is posting at the same time. Rather than stall this thread
+         // parsing the whole buffer, drop it while we are within the contention discard budget
+         if (!discardProfilingBuffer(vmThread, dataStart, true))
+            return false;
          }
       }
    return true;
    }
 
+// Drops the content of a java thread's profiling buffer unless doing so would exceed
+// the percentage of buffers we are allowed to discard. Buffers dropped because the iprofiler
+// monitor was contended have their own budget (iprofilerBufferMaxPercentageToDiscardOnContention, 10% by default);
+// the others are limited by iprofilerBufferMaxPercentageToDiscard (0 by default), counting every discarded buffer
+// Returns true if the buffer was discarded
+bool TR_IProfiler::discardProfilingBuffer(J9VMThread *vmThread, const U_8* dataStart, bool onContention)
+   {
+   uint64_t numSkipped = onContention ? _numRequestsSkippedOnContention : _numRequestsSkipped;
+   int32_t maxPercentageToDiscard = onContention ? TR::Options::_iprofilerBufferMaxPercentageToDiscardOnContention : TR::Options::_iprofilerBufferMaxPercentageToDiscard;
+   if (100*numSkipped >= (uint64_t)maxPercentageToDiscard * _numRequests)
+      {
+      _numRequestsParsedByJavaThreads++;
+      return false;
+      }
+   _numRequestsSkipped++;
+   if (onContention)
+      _numRequestsSkippedOnContention++;
+   setProfilingBufferCursor(vmThread, (U_8*)dataStart);
+   return true;
+   }
+
 
 // This method is executed by the iprofiling thread
 void TR_IProfiler::processWorkingQueue()
@@ -3845,24 +3867,41 @@ void TR_IProfiler::processWorkingQueue()
          {
          // process the buffer after acquiring VM access
          acquireVMAccessNoSuspend(_iprofilerThread);   // blocking. Will wait for the entire GC
-         // Check to see if GC has invalidated this buffer
-         if (_crtProfilingBuffer->isValid())
-            {
-         //fprintf(stderr, "IProfiler thread will process buffer %p of size %u\n", profilingBuffer->getBuffer(), profilingBuffer->getSize());
-            parseBuffer(_iprofilerThread, _crtProfilingBuffer->getBuffer(), _crtProfilingBuffer->getSize());
-         //fprintf(stderr, "IProfiler thread finished processing\n");
-            }
+         // Keep VM access while buffers are queued back to back, so that a burst of
+         // buffers during warm-up costs one VM access round trip instead of one per buffer.
+         // Stop the batch as soon as someone asks for exclusive access (e.g. GC unloading
+         // classes), because the buffers cannot be invalidated while we hold VM access
+         do {
+            // Check to see if GC has invalidated this buffer
+            if (_crtProfilingBuffer->isValid())
+               {
+               parseBuffer(_iprofilerThread, _crtProfilingBuffer->getBuffer(), _crtProfilingBuffer->getSize());
+               }
+            // attach the buffer to the buffer pool
+            _iprofilerMonitor->enter();
+            _freeBufferList.add(_crtProfilingBuffer);
+            _crtProfilingBuffer = NULL;
+            _numOutstandingBuffers--;
+            if (_workingBufferList.isEmpty() ||
+                _workingBufferList.getFirst()->getSize() == 0 || // special buffer; handle it outside VM access
+                (_iprofilerThread->publicFlags & J9_PUBLIC_FLAGS_HALT_THREAD_EXCLUSIVE))
+               {
+               _iprofilerMonitor->exit();
+               break;
+               }
+            _crtProfilingBuffer = _workingBufferList.pop();
+            if (_workingBufferList.isEmpty())
+               _workingBufferTail = NULL;
+            _iprofilerMonitor->exit();
+            _numBuffersParsedInBatch++;
+            } while (true);
          releaseVMAccess(_iprofilerThread);
          }
       else // Special
          {
          break;
          }
-      // attach the buffer to the buffer pool
       _iprofilerMonitor->enter();
-      _freeBufferList.add(_crtProfilingBuffer);
-      _crtProfilingBuffer = NULL;
-      _numOutstandingBuffers--;
       }while(1);
    }
 
@@ -4662,3 +4701,320 @@ void TR_IProfiler::dumpIPBCDataCallGraph(J9VMThread* vmThread)
 
    fprintf(stderr, "Finished dumping info\n");
    }
+
+// Pairs an IProfiler entry with the ROM class its pc belongs to; used to group
+// entries by class when writing the standalone profile file
+struct TR_IPFileDumpItem
+   {
+   J9ROMClass *_romClass;
+   TR_IPBytecodeHashTableEntry *_entry;
+   };
+
+// Callback for qsort to sort by ROM class and then by pc
+static int compareByROMClassAndPC(const void *a, const void *b)
+   {
+   const TR_IPFileDumpItem *itemA = (const TR_IPFileDumpItem *)a;
+   const TR_IPFileDumpItem *itemB = (const TR_IPFileDumpItem *)b;
+   if (itemA->_romClass != itemB->_romClass)
+      return ((uintptrj_t)itemA->_romClass < (uintptrj_t)itemB->_romClass) ? -1 : 1;
+   if (itemA->_entry->getPC() != itemB->_entry->getPC())
+      return (itemA->_entry->getPC() < itemB->_entry->getPC()) ? -1 : 1;
+   return 0;
+   }
+
+// Callback for qsort to sort the classes read from the profile file by ROM class size
+static int compareByROMSize(const void *a, const void *b)
+   {
+   uint32_t sizeA = (*(TR_IPFileClassHeader **)a)->romSize;
+   uint32_t sizeB = (*(TR_IPFileClassHeader **)b)->romSize;
+   if (sizeA != sizeB)
+      return (sizeA < sizeB) ? -1 : 1;
+   return 0;
+   }
+
+static uint32_t persistedEntrySize(TR_IPBCDataStorageHeader *storage)
+   {
+   if (storage->ID == TR_IPBCD_FOUR_BYTES)
+      return sizeof(TR_IPBCDataFourBytesStorage);
+   if (storage->ID == TR_IPBCD_EIGHT_WORDS)
+      return sizeof(TR_IPBCDataEightWordsStorage);
+   return 0;
+   }
+
+// Write the branch and switch profiles of all loaded classes to fileName.
+// Must be called at shutdown after the IProfiler thread has been stopped.
+void
+TR_IProfiler::dumpProfilesToFile(J9VMThread *vmThread, const char *fileName)
+   {
+   PORT_ACCESS_FROM_PORT(_portLib);
+
+   // Need to have VM access to prevent classes from being unloaded while we look at them
+   bool haveAcquiredVMAccess = false;
+   if (!(vmThread->publicFlags & J9_PUBLIC_FLAGS_VM_ACCESS))
+      {
+      acquireVMAccessNoSuspend(vmThread);
+      haveAcquiredVMAccess = true;
+      }
+
+   uint32_t maxItems = 0;
+   for (int32_t bucket = 0; bucket < BC_HASH_TABLE_SIZE; bucket++)
+      {
+      for (TR_IPBytecodeHashTableEntry *entry = _bcHashTable[bucket]; entry; entry = entry->getNext())
+         {
+         if (entry->asIPBCDataFourBytes() || entry->asIPBCDataEightWords())
+            maxItems++;
+         }
+      }
+
+   TR_IPFileDumpItem *items = NULL;
+   U_8 *buffer = NULL;
+   if (maxItems > 0)
+      {
+      items = (TR_IPFileDumpItem *)j9mem_allocate_memory(maxItems * sizeof(TR_IPFileDumpItem), J9MEM_CATEGORY_JIT);
+      // Worst case: one class per entry and every entry is a switch
+      buffer = (U_8 *)j9mem_allocate_memory(sizeof(TR_IPFileHeader) +
+         maxItems * (sizeof(TR_IPFileClassHeader) + sizeof(TR_IPBCDataEightWordsStorage)), J9MEM_CATEGORY_JIT);
+      }
+
+   if (items && buffer)
+      {
+      J9InternalVMFunctions *vmFunctions = vmThread->javaVM->internalVMFunctions;
+      uint32_t numItems = 0;
+      for (int32_t bucket = 0; bucket < BC_HASH_TABLE_SIZE && numItems < maxItems; bucket++)
+         {
+         for (TR_IPBytecodeHashTableEntry *entry = _bcHashTable[bucket]; entry && numItems < maxItems; entry = entry->getNext())
+            {
+            if (!(entry->asIPBCDataFourBytes() || entry->asIPBCDataEightWords()))
+               continue;
+            if (entry->isInvalid() || invalidateEntryIfInconsistent(entry))
+               continue;
+            J9ClassLoader *loader;
+            J9ROMClass *romClass = vmFunctions->findROMClassFromPC(vmThread, (UDATA)entry->getPC(), &loader);
+            if (!romClass)
+               continue;
+            items[numItems]._romClass = romClass;
+            items[numItems]._entry = entry;
+            numItems++;
+            }
+         }
+
+      qsort(items, numItems, sizeof(*items), compareByROMClassAndPC);
+
+      TR_IPFileHeader *header = (TR_IPFileHeader *)buffer;
+      header->magic = TR_IPFILE_MAGIC;
+      header->version = TR_IPFILE_VERSION;
+      header->numClasses = 0;
+      header->numEntries = numItems;
+      U_8 *cursor = buffer + sizeof(TR_IPFileHeader);
+      TR_IPFileClassHeader *classHeader = NULL;
+      for (uint32_t i = 0; i < numItems; i++)
+         {
+         J9ROMClass *romClass = items[i]._romClass;
+         if (i == 0 || items[i-1]._romClass != romClass)
+            {
+            classHeader = (TR_IPFileClassHeader *)cursor;
+            classHeader->romSize = romClass->romSize;
+            classHeader->romCRC = j9crc32(0, (U_8 *)romClass, romClass->romSize);
+            classHeader->numEntries = 0;
+            classHeader->entriesSize = 0;
+            header->numClasses++;
+            cursor += sizeof(TR_IPFileClassHeader);
+            }
+         TR_IPBytecodeHashTableEntry *entry = items[i]._entry;
+         entry->createPersistentCopy((uintptrj_t)romClass, (TR_IPBCDataStorageHeader *)cursor, NULL);
+         uint32_t entrySize = entry->getBytesFootprint();
+         classHeader->numEntries++;
+         classHeader->entriesSize += entrySize;
+         cursor += entrySize;
+         }
+
+      IDATA fileId = j9file_open(fileName, EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0660);
+      if (fileId != -1)
+         {
+         UDATA length = cursor - buffer;
+         if ((UDATA)j9file_write(fileId, buffer, length) != length)
+            j9tty_printf(PORTLIB, "Error: cannot write IProfiler profiles to %s\n", fileName);
+         j9file_close(fileId);
+         if (TR::Options::getCmdLineOptions()->getVerboseOption(TR_VerbosePerformance))
+            TR_VerboseLog::writeLineLocked(TR_Vlog_PERF, "Wrote %u IProfiler entries for %u classes to %s",
+               header->numEntries, header->numClasses, fileName);
+         }
+      else
+         {
+         j9tty_printf(PORTLIB, "Error: cannot open %s for writing IProfiler profiles\n", fileName);
+         }
+      }
+
+   if (items)
+      j9mem_free_memory(items);
+   if (buffer)
+      j9mem_free_memory(buffer);
+
+   if (haveAcquiredVMAccess)
+      releaseVMAccessNoSuspend(vmThread);
+   }
+
+// Read a profile file written by dumpProfilesToFile. The entries are applied
+// lazily, as the classes they belong to get loaded (see applyPersistedProfiles)
+bool
+TR_IProfiler::loadProfilesFromFile(const char *fileName)
+   {
+   PORT_ACCESS_FROM_PORT(_portLib);
+
+   IDATA fileId = j9file_open(fileName, EsOpenRead, 0);
+   if (fileId == -1)
+      return false; // first run; the file will be created at shutdown
+
+   I_64 fileLength = j9file_flength(fileId);
+   if (fileLength < (I_64)sizeof(TR_IPFileHeader) || fileLength > (I_64)0x7FFFFFFF)
+      {
+      j9file_close(fileId);
+      return false;
+      }
+
+   uint32_t length = (uint32_t)fileLength;
+   U_8 *buffer = (U_8 *)jitPersistentAlloc(length);
+   if (!buffer)
+      {
+      j9file_close(fileId);
+      return false;
+      }
+
+   uint32_t bytesRead = 0;
+   while (bytesRead < length)
+      {
+      IDATA rc = j9file_read(fileId, buffer + bytesRead, length - bytesRead);
+      if (rc <= 0)
+         break;
+      bytesRead += (uint32_t)rc;
+      }
+   j9file_close(fileId);
+
+   TR_IPFileHeader *header = (TR_IPFileHeader *)buffer;
+   if (bytesRead != length ||
+       header->magic != TR_IPFILE_MAGIC ||
+       header->version != TR_IPFILE_VERSION ||
+       header->numClasses == 0)
+      {
+      jitPersistentFree(buffer);
+      return false;
+      }
+
+   TR_IPFileClassHeader **classes = (TR_IPFileClassHeader **)jitPersistentAlloc(header->numClasses * sizeof(TR_IPFileClassHeader *));
+   if (!classes)
+      {
+      jitPersistentFree(buffer);
+      return false;
+      }
+
+   // Validate the layout once so that applyPersistedProfiles can trust it
+   U_8 *cursor = buffer + sizeof(TR_IPFileHeader);
+   U_8 *end = buffer + length;
+   uint32_t numClasses = 0;
+   while (numClasses < header->numClasses && cursor + sizeof(TR_IPFileClassHeader) <= end)
+      {
+      TR_IPFileClassHeader *classHeader = (TR_IPFileClassHeader *)cursor;
+      U_8 *entriesEnd = cursor + sizeof(TR_IPFileClassHeader) + classHeader->entriesSize;
+      if (entriesEnd > end)
+         break;
+      cursor += sizeof(TR_IPFileClassHeader);
+      bool valid = true;
+      while (cursor < entriesEnd)
+         {
+         TR_IPBCDataStorageHeader *storage = (TR_IPBCDataStorageHeader *)cursor;
+         if (cursor + sizeof(TR_IPBCDataStorageHeader) > entriesEnd)
+            {
+            valid = false;
+            break;
+            }
+         uint32_t entrySize = persistedEntrySize(storage);
+         if (entrySize == 0 || cursor + entrySize > entriesEnd || storage->pc >= classHeader->romSize)
+            {
+            valid = false;
+            break;
+            }
+         cursor += entrySize;
+         }
+      if (!valid)
+         break;
+      classes[numClasses++] = classHeader;
+      }
+
+   if (numClasses != header->numClasses)
+      {
+      jitPersistentFree(classes);
+      jitPersistentFree(buffer);
+      return false;
+      }
+
+   qsort(classes, numClasses, sizeof(*classes), compareByROMSize);
+   _persistedClasses = classes;
+   _numPersistedClasses = numClasses;
+
+   if (TR::Options::getCmdLineOptions()->getVerboseOption(TR_VerbosePerformance))
+      TR_VerboseLog::writeLineLocked(TR_Vlog_PERF, "Read %u IProfiler entries for %u classes from %s",
+         header->numEntries, numClasses, fileName);
+   return true;
+   }
+
+// Populate the bytecode hashtable with the entries read from the profile file
+// for romClass, provided the ROM class is identical to the one that was profiled
+void
+TR_IProfiler::applyPersistedProfiles(J9ROMClass *romClass)
+   {
+   if (!_persistedClasses || !_isIProfilingEnabled)
+      return;
+
+   // Find the first class with a matching size
+   uint32_t romSize = romClass->romSize;
+   uint32_t low = 0;
+   uint32_t high = _numPersistedClasses;
+   while (low < high)
+      {
+      uint32_t mid = low + (high - low) / 2;
+      if (_persistedClasses[mid]->romSize < romSize)
+         low = mid + 1;
+      else
+         high = mid;
+      }
+
+   // Only compute the CRC when there is a candidate; most classes will be rejected by size
+   uint32_t romCRC = 0;
+   bool romCRCComputed = false;
+   for (uint32_t i = low; i < _numPersistedClasses && _persistedClasses[i]->romSize == romSize; i++)
+      {
+      TR_IPFileClassHeader *classHeader = _persistedClasses[i];
+      if (!romCRCComputed)
+         {
+         romCRC = j9crc32(0, (U_8 *)romClass, romSize);
+         romCRCComputed = true;
+         }
+      if (classHeader->romCRC != romCRC)
+         continue;
+
+      U_8 *cursor = (U_8 *)(classHeader + 1);
+      U_8 *end = cursor + classHeader->entriesSize;
+      while (cursor < end)
+         {
+         TR_IPBCDataStorageHeader *storage = (TR_IPBCDataStorageHeader *)cursor;
+         cursor += persistedEntrySize(storage);
+
+         uintptrj_t pc = (uintptrj_t)romClass + storage->pc;
+         U_8 byteCode = *(U_8 *)pc;
+         if (storage->ID == TR_IPBCD_FOUR_BYTES ? !isCompact(byteCode) : !isSwitch(byteCode))
+            continue;
+
+         // Never overwrite samples collected during this run
+         int32_t bucket = bcHash(pc);
+         if (searchForSample(pc, bucket))
+            continue;
+         TR_IPBytecodeHashTableEntry *entry = findOrCreateEntry(bucket, pc, true);
+         if (entry)
+            {
+            entry->loadFromPersistentCopy(storage, NULL, (uintptrj_t)romClass);
+            _numPersistedEntriesApplied++;
+            }
+         }
+      break;
+      }
+   }
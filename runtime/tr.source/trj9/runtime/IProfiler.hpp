@@ -172,6 +172,33 @@ typedef struct TR_IPBCDataCallGraphStorage
    CallSiteProfileInfo _csInfo;
    } TR_IPBCDataCallGraphStorage;
 
+// Layout of the standalone profile file written at shutdown and read at startup
+// when -Xjit:iprofilerPersistFile=<file> is specified. The file is a flat sequence
+// of fixed layout records with no embedded pointers:
+//    TR_IPFileHeader
+//    { TR_IPFileClassHeader, TR_IPBCData{FourBytes,EightWords}Storage * numEntries } * numClasses
+// A class is identified by the size and the CRC of its ROM class bytes and the pc
+// of every entry is stored as an offset from the start of that ROM class.
+// Call graph entries are not written because they refer to J9Class pointers.
+#define TR_IPFILE_MAGIC   0x46504949 // "IIPF"
+#define TR_IPFILE_VERSION 1
+
+typedef struct TR_IPFileHeader
+   {
+   uint32_t magic;
+   uint32_t version;
+   uint32_t numClasses;
+   uint32_t numEntries;
+   } TR_IPFileHeader;
+
+typedef struct TR_IPFileClassHeader
+   {
+   uint32_t romSize;
+   uint32_t romCRC;
+   uint32_t numEntries;
+   uint32_t entriesSize; // bytes of entry storage following this header
+   } TR_IPFileClassHeader;
+
 enum TR_EntryStatusInfo
    {
    IPBC_ENTRY_CANNOT_PERSIST = 0,
@@ -481,6 +508,10 @@ public:
    void shutdown();
    void outputStats();
    void dumpIPBCDataCallGraph(J9VMThread* currentThread);
+   // standalone profile file support (-Xjit:iprofilerPersistFile=)
+   bool loadProfilesFromFile(const char *fileName);
+   void dumpProfilesToFile(J9VMThread *vmThread, const char *fileName);
+   void applyPersistedProfiles(J9ROMClass *romClass); // called for class load
    void resetProfiler();
    void startIProfilerThread(J9JavaVM *javaVM);
    void deallocateIProfilerBuffers();
@@ -558,6 +589,7 @@ public:
    // this is wapper of registered version, for the helper function, from JitRunTime
 
 private:
+   bool discardProfilingBuffer(J9VMThread *vmThread, const U_8* dataStart, bool onContention);
 #ifdef J9VM_INTERP_PROFILING_BYTECODES
    U_8 *getProfilingBufferCursor(J9VMThread *vmThread) const { return vmThread->profilingBufferCursor; }
    void setProfilingBufferCursor(J9VMThread *vmThread, U_8* p) { vmThread->profilingBufferCursor = p; }
@@ -680,7 +712,10 @@ private:
    volatile int32_t                _numOutstandingBuffers;
    uint64_t                        _numRequests;
    uint64_t                        _numRequestsSkipped;
+   uint64_t                        _numRequestsSkippedOnContention; // included in _numRequestsSkipped
    uint64_t                        _numRequestsHandedToIProfilerThread;
+   uint64_t                        _numRequestsParsedByJavaThreads; // info stats only
+   uint64_t                        _numBuffersParsedInBatch; // info stats only
    volatile uint32_t               _iprofilerThreadExitFlag;
    volatile bool                   _iprofilerThreadAttachAttempted;
    uint64_t                        _iprofilerNumRecords; // info stats only
@@ -690,6 +725,11 @@ private:
    uint32_t                        _iprofilerBufferSize;
    TR_ReadSampleRequestsHistory   *_readSampleRequestsHistory;
 
+   // profiles read from the standalone profile file, sorted by ROM class size
+   TR_IPFileClassHeader          **_persistedClasses;
+   uint32_t                        _numPersistedClasses;
+   uint32_t                        _numPersistedEntriesApplied; // info stats only
+
 
    public:
    static int32_t                  _STATS_noProfilingInfo;
@@ -2573,7 +2573,7 @@ TR_RelocationRecordProfiledInlinedMethod::preparePrivateData(TR_RelocationRuntim
          RELO_LOG(reloRuntime->reloLogger(), 6,"\tpreparePrivateData: inlined class valid\n");
          reloPrivateData->_inlinedCodeClass = inlinedCodeClass;
          uintptrj_t *chainData = (uintptrj_t *) reloRuntime->fej9()->sharedCache()->pointerFromOffsetInSharedCache((void *) classChainForInlinedMethod(reloTarget));
-         if (reloRuntime->fej9()->sharedCache()->classMatchesCachedVersion(inlinedCodeClass, chainData))
+         if (reloRuntime->validateClassChain(inlinedCodeClass, chainData))
             {
             RELO_LOG(reloRuntime->reloLogger(), 6,"\tpreparePrivateData: classes match\n");
             TR_OpaqueMethodBlock *inlinedMethod = * (TR_OpaqueMethodBlock **) (((uint8_t *)reloPrivateData->_inlinedCodeClass) + vTableSlot(reloTarget));
@@ -2841,7 +2841,7 @@ TR_RelocationRecordValidateClass::validateClass(TR_RelocationRuntime *reloRuntim
    // classChainOrRomClass, for classes and instance fields, is a class chain pointer from the relocation record
 
    void *classChain = classChainOrRomClass;
-   return reloRuntime->fej9()->sharedCache()->classMatchesCachedVersion(clazz, (uintptrj_t *) classChain);
+   return reloRuntime->validateClassChain(clazz, (uintptrj_t *) classChain);
    }
 
 int32_t
@@ -82,6 +82,7 @@ TR_RelocationRuntime::TR_RelocationRuntime(J9JITConfig *jitCfg)
    _trMemory = NULL;
    _options = TR::Options::getAOTCmdLineOptions();
    _compInfo = TR::CompilationInfo::get(_jitConfig);
+   memset(_validatedClassChains, 0, sizeof(_validatedClassChains));
 
    PORT_ACCESS_FROM_JAVAVM(javaVM());
    _reloLogger = new (PERSISTENT_NEW) TR_RelocationRuntimeLogger(this);
@@ -669,6 +670,39 @@ TR_RelocationRuntime::relocateMethodMetaData(UDATA codeRelocationAmount, UDATA d
    }
 
 
+bool
+TR_RelocationRuntime::canRememberClassChainValidation(TR_OpaqueClassBlock *clazz)
+   {
+   // A J9Class pointer can only stand for the validated class while the class stays loaded
+   // and unchanged. Classes from the bootstrap and application loaders are never unloaded;
+   // redefinition can replace the ROM classes in a hierarchy, so nothing is kept under HCR.
+   if (options()->getOption(TR_EnableHCR))
+      return false;
+
+   J9ClassLoader *classLoader = ((J9Class *)clazz)->classLoader;
+   return (classLoader == javaVM()->systemClassLoader) || (classLoader == javaVM()->applicationClassLoader);
+   }
+
+bool
+TR_RelocationRuntime::validateClassChain(TR_OpaqueClassBlock *clazz, uintptrj_t *classChain)
+   {
+   TR_ValidatedClassChain *entry = &_validatedClassChains[(((uintptrj_t)classChain >> 3) ^ ((uintptrj_t)clazz >> 8)) % ValidatedClassChainCacheSize];
+   if ((entry->_clazz == clazz) && (entry->_classChain == classChain))
+      {
+      RELO_LOG(reloLogger(), 6, "\tvalidateClassChain: class %p chain %p validated previously\n", clazz, classChain);
+      return true;
+      }
+
+   if (!fej9()->sharedCache()->classMatchesCachedVersion(clazz, classChain))
+      return false;
+
+   if (canRememberClassChainValidation(clazz))
+      {
+      entry->_clazz = clazz;
+      entry->_classChain = classChain;
+      }
+   return true;
+   }
 
 bool
 TR_RelocationRuntime::aotMethodHeaderVersionsMatch()
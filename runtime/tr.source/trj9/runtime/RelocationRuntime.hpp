@@ -210,6 +210,10 @@ class TR_RelocationRuntime {
          return _globalValueNames[g];
          }
 
+      // Check clazz against a class chain stored in the shared cache, reusing the result of
+      // an earlier successful check made by this relocation runtime when it is still valid
+      bool validateClassChain(TR_OpaqueClassBlock *clazz, uintptrj_t *classChain);
+
       bool isLoading() { return _isLoading; }
       void setIsLoading() { _isLoading = true; }
       void resetIsLoading() { _isLoading = false; }
@@ -280,6 +284,19 @@ class TR_RelocationRuntime {
       TR_AotRelocationCleanUp _relocationStatus;
       void relocationFailureCleanup();
 
+      bool canRememberClassChainValidation(TR_OpaqueClassBlock *clazz);
+
+      // Direct mapped cache of (class, class chain) pairs that passed validation. Most AOT bodies
+      // validate the same handful of core classes, so remembering them saves walking the class
+      // hierarchy again for every method loaded from the shared cache.
+      enum { ValidatedClassChainCacheSize = 256 };
+      struct TR_ValidatedClassChain
+         {
+         TR_OpaqueClassBlock *_clazz;
+         uintptrj_t *_classChain;
+         };
+      TR_ValidatedClassChain _validatedClassChains[ValidatedClassChainCacheSize];
+
       static bool       _globalValuesInitialized;
       static uintptr_t  _globalValueList[TR_NumGlobalValueItems];
       static uint8_t    _globalValueSizeList[TR_NumGlobalValueItems];
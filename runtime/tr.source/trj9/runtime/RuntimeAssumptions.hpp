@@ -59,7 +59,7 @@ class TR_PersistentClassInfo : public TR_Link0<TR_PersistentClassInfo>
    {
    public:
    TR_PERSISTENT_ALLOC(TR_Memory::PersistentInfo);
-   TR_PersistentClassInfo(TR_OpaqueClassBlock *id) : _classId(id), _fieldInfo(0), _prexAssumptions(0), _timeStamp(0), _nameLength(-1)
+   TR_PersistentClassInfo(TR_OpaqueClassBlock *id) : _classId(id), _fieldInfo(0), _prexAssumptions(0), _timeStamp(0), _nameLength(-1), _visitEpoch(0)
     {
     uintptrj_t classPointerValue = (uintptrj_t) id;
 
@@ -82,14 +82,17 @@ class TR_PersistentClassInfo : public TR_Link0<TR_PersistentClassInfo>
    TR_SubClass *getFirstSubclass() { return _subClasses.getFirst(); }
    void setFirstSubClass(TR_SubClass *sc) { _subClasses.setFirst(sc); }
 
-   void setVisited() {_visitedStatus |= 1; }
-   void resetVisited() { _visitedStatus = _visitedStatus & ~(uintptrj_t)1; }
-   bool hasBeenVisited()
-    {
-    if (_visitedStatus & 1)
-       return true;
-    return false;
-    }
+   // A class counts as visited when it was marked during the current visit epoch, so all
+   // the visited marks in the hierarchy can be dropped at once by starting a new epoch
+   // instead of walking every class (see TR_PersistentCHTable::resetVisitedClasses)
+   //
+   void setVisited() { _visitEpoch = _currentVisitEpoch; }
+   void resetVisited() { _visitEpoch = 0; }
+   bool hasBeenVisited() { return _visitEpoch == _currentVisitEpoch; }
+
+   // Returns false when the epoch counter wrapped; marks left from an earlier use of the
+   // new epoch value must then be reset individually
+   static bool startNewVisitEpoch();
 
    TR_PersistentClassInfoForFields *getFieldInfo()
       {
@@ -180,6 +183,9 @@ class TR_PersistentClassInfo : public TR_Link0<TR_PersistentClassInfo>
    int32_t                             _nameLength;
    flags8_t                            _flags;
    flags8_t                            _shouldNotBeNewlyExtended; // one bit for each possible compilation thread
+   uint16_t                            _visitEpoch; // 0 is never a current epoch
+
+   static uint16_t                     _currentVisitEpoch; // protected by the class table mutex
    };
 
 class TR_AddressRange
@@ -76,13 +76,23 @@ J9JITExceptionTable* hash_jit_artifact_search(J9JITHashTable *table, UDATA searc
 
 
 J9JITExceptionTable* jit_artifact_search(J9AVLTree *tree, UDATA searchValue) {
-        /* find the right hash table to look in */
-        J9JITHashTable *table = (J9JITHashTable*)avl_search(tree, searchValue);
-        if (table) {
-                /* return the result of looking in the correct hash table */
-                return hash_jit_artifact_search(table, searchValue);
-        }
-        return NULL;
+   /* Find the right hash table to look in.  This is the same walk avl_search() does using
+    * avl_jit_artifact_searchCompare(), but with the code cache range check done inline rather
+    * than through the tree's comparator, as this is on the path of every JIT frame a stack walk
+    * visits.  Readers do not lock the tree, exactly as for avl_search().
+    */
+   J9JITHashTable *table = (J9JITHashTable*)tree->rootNode;
+   while (NULL != table) {
+      if (searchValue >= table->end) {
+         table = (J9JITHashTable*)J9JITHASHTABLE_RIGHTCHILD(table);
+      } else if (searchValue < table->start) {
+         table = (J9JITHashTable*)J9JITHASHTABLE_LEFTCHILD(table);
+      } else {
+         /* return the result of looking in the correct hash table */
+         return hash_jit_artifact_search(table, searchValue);
+      }
+   }
+   return NULL;
 }
 
 
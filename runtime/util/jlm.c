@@ -117,6 +117,8 @@
 #define JLM_DUMP_FORMAT_SIZE       8
 /* version */
 #define JLM_DUMP_VERSION           1
+/* adaptive spin success rate */
+#define JLM_DUMP_SPIN_RATE_SIZE    4
 
 
 static void GetMonitorName (J9VMThread *vmThread, J9ThreadAbstractMonitor *monitor, char *nameBuf);
@@ -180,7 +182,7 @@ request_MonitorJlmDump(jvmtiEnv * env, J9VMJlmDump * jlmd, jint dump_format)
 
 			/* If format with tags is required, write the tag (8 bytes),
 			   otherwise write 0 in the objectid field - 4 or 8 bytes */
-			if (dump_format == COM_IBM_JLM_DUMP_FORMAT_TAGS) {
+			if (dump_format != COM_IBM_JLM_DUMP_FORMAT_OBJECT_ID) {
 				jlong tag = 0;
 					if (monitor->flags & J9THREAD_MONITOR_OBJECT) {
 					j9object_t object = (j9object_t) monitor->userData;
@@ -206,6 +208,21 @@ request_MonitorJlmDump(jvmtiEnv * env, J9VMJlmDump * jlmd, jint dump_format)
 
 				WRITE_8BYTES(tag);
 
+				if (dump_format == COM_IBM_JLM_DUMP_FORMAT_SPIN_RATE) {
+					/* 0 if the monitor has no adaptive spin history */
+					U_32 spinSuccessRate = 0;
+					if (monitor->flags & J9THREAD_MONITOR_OBJECT) {
+						j9object_t object = (j9object_t) monitor->userData;
+						if (object != NULL) {
+							J9ObjectMonitor *objectMonitor = monitorTablePeek(jvm, vmThread, object);
+							if (objectMonitor != NULL) {
+								spinSuccessRate = objectMonitor->spinSuccessRate;
+							}
+						}
+					}
+					WRITE_4BYTES(spinSuccessRate);
+				}
+
 			} else {
 				/* The next field has a pointer size */
 				if (sizeof(void *) == 4) {
@@ -240,8 +257,11 @@ request_MonitorJlmDump(jvmtiEnv * env, J9VMJlmDump * jlmd, jint dump_format)
 		WRITE_8BYTES(0);
 #endif /* defined(OMR_THR_JLM_HOLD_TIMES) */
 
-		if (dump_format == COM_IBM_JLM_DUMP_FORMAT_TAGS) {
+		if (dump_format != COM_IBM_JLM_DUMP_FORMAT_OBJECT_ID) {
 			WRITE_8BYTES(0);
+			if (dump_format == COM_IBM_JLM_DUMP_FORMAT_SPIN_RATE) {
+				WRITE_4BYTES(0);
+			}
 		} else {
 			/* The next field has a pointer size */
 			if (sizeof(void *) == 8) {
@@ -410,6 +430,9 @@ jint request_MonitorJlmDumpSize(J9JavaVM * jvm, UDATA * dump_size, jint dump_for
 	if (dump_format != COM_IBM_JLM_DUMP_FORMAT_OBJECT_ID) {
 		*dump_size    = JLM_DUMP_FORMAT_SIZE;
 		objIDfieldSize = 8;
+		if (dump_format == COM_IBM_JLM_DUMP_FORMAT_SPIN_RATE) {
+			objIDfieldSize += JLM_DUMP_SPIN_RATE_SIZE;
+		}
 	} else {
 		*dump_size = 0;
 		objIDfieldSize = sizeof(void *);
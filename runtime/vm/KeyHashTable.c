@@ -342,7 +342,11 @@ growClassHashTable(J9JavaVM *vm, J9ClassLoader *classLoader, classTableEntry *ne
 	/* If -XX:+FastClassHashTable is enabled, attempt to allocate a new, larger hash table, otherwise return failure */
 	if (J9_ARE_ALL_BITS_SET(vm->extendedRuntimeFlags, J9_EXTENDED_RUNTIME_FAST_CLASS_HASH_TABLE)) {
 		J9HashTable *oldTable = classLoader->classHashTable;
-		J9HashTable *newTable = hashTableNew(oldTable->portLibrary, J9_GET_CALLSITE(), oldTable->tableSize + 1, sizeof(classTableEntry), sizeof(char *), J9HASH_TABLE_DO_NOT_GROW | J9HASH_TABLE_ALLOW_SIZE_OPTIMIZATION, J9MEM_CATEGORY_CLASSES, classHashFn, classHashEqualFn, NULL, vm);
+		/* Double the size, so a loader defining N classes copies O(N) entries in total, and the superseded
+		 * tables kept until exclusive access is next released are together no larger than the new one.
+		 */
+		U_32 newSize = (oldTable->tableSize <= (U_32_MAX / 2)) ? (oldTable->tableSize * 2) : U_32_MAX;
+		J9HashTable *newTable = hashTableNew(oldTable->portLibrary, J9_GET_CALLSITE(), newSize, sizeof(classTableEntry), sizeof(char *), J9HASH_TABLE_DO_NOT_GROW | J9HASH_TABLE_ALLOW_SIZE_OPTIMIZATION, J9MEM_CATEGORY_CLASSES, classHashFn, classHashEqualFn, NULL, vm);
 		if (NULL != newTable) {
 			J9HashTableState walkState;
 			classTableEntry *oldNode = NULL;
@@ -499,6 +499,22 @@ spinOnTryEnter(J9VMThread *currentThread, J9ObjectMonitor *objectMonitor, j9obje
 	}
 #endif /* defined(OMR_THR_THREE_TIER_LOCKING) && defined(OMR_THR_SPIN_WAKE_CONTROL) */
 
+	/* Scale the yield budget by how often spinning has recently acquired this monitor. Once spinning
+	 * rarely succeeds, make a single pass so that the rate can still recover if the monitor's behaviour changes.
+	 */
+	UDATA const adaptiveSpinning = vm->thrAdaptiveTryEnterSpinning;
+	bool spinFailed = false;
+	if (0 != adaptiveSpinning) {
+		U_32 const spinSuccessRate = objectMonitor->spinSuccessRate;
+		tryEnterYieldCount = (tryEnterYieldCount * spinSuccessRate) >> J9_OBJECT_MONITOR_SPIN_RATE_SHIFT;
+		if (0 == tryEnterYieldCount) {
+			tryEnterYieldCount = 1;
+		}
+		if (spinSuccessRate < J9_OBJECT_MONITOR_SPIN_RATE_MIN) {
+			tryEnterSpinCount2 = 1;
+		}
+	}
+
 	/* Need to store the original value of tryEnterSpinCount2 since it gets overridden during non-nested spinning */
 	UDATA tryEnterSpinCount2Init = tryEnterSpinCount2;
 	
@@ -558,8 +574,21 @@ spinOnTryEnter(J9VMThread *currentThread, J9ObjectMonitor *objectMonitor, j9obje
 		omrthread_yield();
 #endif /* OMR_THR_YIELD_ALG */
 	}
+	/* spin budget exhausted without acquiring the monitor */
+	spinFailed = true;
 
 update_jlm:
+	if (0 != adaptiveSpinning) {
+		/* Racy update is acceptable - the rate is only a hint and is reported by JLM */
+		U_32 spinSuccessRate = objectMonitor->spinSuccessRate;
+		if (rc) {
+			spinSuccessRate += (J9_OBJECT_MONITOR_SPIN_RATE_ONE - spinSuccessRate) >> J9_OBJECT_MONITOR_SPIN_RATE_DECAY_SHIFT;
+			objectMonitor->spinSuccessRate = spinSuccessRate;
+		} else if (spinFailed) {
+			spinSuccessRate -= spinSuccessRate >> J9_OBJECT_MONITOR_SPIN_RATE_DECAY_SHIFT;
+			objectMonitor->spinSuccessRate = spinSuccessRate;
+		}
+	}
 #if defined(OMR_THR_JLM)
 	if (NULL != tracing) {
 		/* Add JLM counts atomically:
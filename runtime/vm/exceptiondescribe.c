@@ -38,6 +38,24 @@ typedef UDATA (*callback_func_t) (J9VMThread * vmThread, void * userData, J9ROMC
 
 static void printExceptionInThread (J9VMThread* vmThread);
 static UDATA isSubclassOfThreadDeath (J9VMThread *vmThread, j9object_t exception);
+static J9ROMClass * findROMClassFromPCCached (J9VMThread *vmThread, UDATA methodPC, J9ClassLoader **classLoader, J9ROMMethod **romMethod, UDATA *methodIndex);
+
+#define STACK_TRACE_FRAME_CACHE_SIZE 256
+#define STACK_TRACE_FRAME_CACHE_INDEX(pc) ((((pc) >> 2) ^ ((pc) >> 10)) & (STACK_TRACE_FRAME_CACHE_SIZE - 1))
+
+/* A bytecode PC from a stack trace, resolved to the method containing it */
+typedef struct J9StackTraceFrameCacheEntry {
+	UDATA methodPC;
+	J9ROMClass *romClass;
+	J9ClassLoader *classLoader;
+	J9ROMMethod *romMethod;
+	UDATA methodIndex;
+} J9StackTraceFrameCacheEntry;
+
+typedef struct J9StackTraceFrameCache {
+	UDATA romClassSegmentFreeCount; /* value of vm->romClassSegmentFreeCount when the entries were filled */
+	J9StackTraceFrameCacheEntry entries[STACK_TRACE_FRAME_CACHE_SIZE];
+} J9StackTraceFrameCache;
 static void printExceptionMessage (J9VMThread* vmThread, j9object_t exception);
 
 
@@ -355,12 +373,9 @@ inlinedEntry:
 				} else {
 					pruneConstructors = FALSE;
 #endif
-					romClass = findROMClassFromPC(vmThread, methodPC, &classLoader);
-					if(romClass) {
-						romMethod = findROMMethodInROMClass(vmThread, romClass, methodPC, &offset);
-						if (romMethod != NULL) {
-							methodPC -= (UDATA) J9_BYTECODE_START_FROM_ROM_METHOD(romMethod);
-						}
+					romClass = findROMClassFromPCCached(vmThread, methodPC, &classLoader, &romMethod, &offset);
+					if (romMethod != NULL) {
+						methodPC -= (UDATA) J9_BYTECODE_START_FROM_ROM_METHOD(romMethod);
 					}
 #ifdef J9VM_INTERP_NATIVE_SUPPORT
 				}
@@ -411,6 +426,70 @@ done:
 	return totalEntries;
 }
 
+/**
+ * Find the ROM class and ROM method containing an interpreted PC from a stack trace.
+ *
+ * Resolving a PC means searching the class memory segments under the classTableMutex and walking
+ * the ROM classes in the segment, which dominates the cost of building a stack trace for code that
+ * throws the same exceptions over and over.  Each thread remembers the PCs it resolved most recently.
+ * The cache is discarded whenever a ROM class segment is freed, as the PC could then belong to
+ * another class.
+ *
+ * @param vmThread The current VM thread.
+ * @param methodPC The PC to look up.
+ * @param classLoader Returns the class loader which owns the ROM class.
+ * @param romMethod Returns the ROM method containing the PC, or NULL if not found.
+ * @param methodIndex Returns the index of romMethod in the ROM class.
+ * @return The ROM class containing the PC, or NULL if not found.
+ *
+ * @note Assumes VM access
+ **/
+static J9ROMClass *
+findROMClassFromPCCached(J9VMThread *vmThread, UDATA methodPC, J9ClassLoader **classLoader, J9ROMMethod **romMethod, UDATA *methodIndex)
+{
+	J9JavaVM *vm = vmThread->javaVM;
+	J9StackTraceFrameCache *cache = (J9StackTraceFrameCache *)vmThread->stackTraceFrameCache;
+	J9StackTraceFrameCacheEntry *entry = NULL;
+	J9ROMClass *romClass = NULL;
+
+	if (NULL == cache) {
+		PORT_ACCESS_FROM_JAVAVM(vm);
+		cache = j9mem_allocate_memory(sizeof(J9StackTraceFrameCache), OMRMEM_CATEGORY_VM);
+		if (NULL != cache) {
+			memset(cache->entries, 0, sizeof(cache->entries));
+			cache->romClassSegmentFreeCount = vm->romClassSegmentFreeCount;
+			vmThread->stackTraceFrameCache = cache;
+		}
+	} else if (cache->romClassSegmentFreeCount != vm->romClassSegmentFreeCount) {
+		memset(cache->entries, 0, sizeof(cache->entries));
+		cache->romClassSegmentFreeCount = vm->romClassSegmentFreeCount;
+	}
+
+	if (NULL != cache) {
+		entry = &cache->entries[STACK_TRACE_FRAME_CACHE_INDEX(methodPC)];
+		if ((0 != methodPC) && (entry->methodPC == methodPC)) {
+			*classLoader = entry->classLoader;
+			*romMethod = entry->romMethod;
+			*methodIndex = entry->methodIndex;
+			return entry->romClass;
+		}
+	}
+
+	*romMethod = NULL;
+	romClass = findROMClassFromPC(vmThread, methodPC, classLoader);
+	if (NULL != romClass) {
+		*romMethod = findROMMethodInROMClass(vmThread, romClass, methodPC, methodIndex);
+		if ((NULL != entry) && (NULL != *romMethod)) {
+			entry->methodPC = methodPC;
+			entry->romClass = romClass;
+			entry->classLoader = *classLoader;
+			entry->romMethod = *romMethod;
+			entry->methodIndex = *methodIndex;
+		}
+	}
+	return romClass;
+}
+
 /**
  * This is an helper function to call exceptionDescribe indirectly from gpProtectAndRun function.
  * 
@@ -1523,7 +1523,7 @@ j9jni_deleteGlobalRef(JNIEnv *env, jobject globalRef, jboolean isWeak)
 	if (globalRef != NULL) {
 
 #ifdef J9VM_THR_PREEMPTIVE
-		omrthread_monitor_enter(vm->jniFrameMutex);
+		omrthread_monitor_enter(vm->jniGlobalReferencesMutex);
 #endif
 
 #if defined(J9VM_GC_REALTIME)
@@ -1536,7 +1536,7 @@ j9jni_deleteGlobalRef(JNIEnv *env, jobject globalRef, jboolean isWeak)
 		}
 
 #ifdef J9VM_THR_PREEMPTIVE
-		omrthread_monitor_exit(vm->jniFrameMutex);
+		omrthread_monitor_exit(vm->jniGlobalReferencesMutex);
 #endif
 
 	}
@@ -1560,7 +1560,7 @@ j9jni_createGlobalRef(JNIEnv *env, j9object_t object, jboolean isWeak)
 	Assert_VM_notNull(object);
 
 #ifdef J9VM_THR_PREEMPTIVE
-	omrthread_monitor_enter(vm->jniFrameMutex);
+	omrthread_monitor_enter(vm->jniGlobalReferencesMutex);
 #endif
 
 	result = (j9object_t*)pool_newElement(isWeak ? vm->jniWeakGlobalReferences : vm->jniGlobalReferences);
@@ -1570,7 +1570,7 @@ j9jni_createGlobalRef(JNIEnv *env, j9object_t object, jboolean isWeak)
 	}
 
 #ifdef J9VM_THR_PREEMPTIVE
-	omrthread_monitor_exit(vm->jniFrameMutex);
+	omrthread_monitor_exit(vm->jniGlobalReferencesMutex);
 #endif
 
 	if (result == NULL) {
@@ -2181,14 +2181,14 @@ getObjectRefType(JNIEnv *env, jobject obj)
 	}
 
 #ifdef J9VM_THR_PREEMPTIVE
-	omrthread_monitor_enter(vm->jniFrameMutex);
+	omrthread_monitor_enter(vm->jniGlobalReferencesMutex);
 #endif
 
 	/* Check for global ref */
 
 	if (pool_includesElement(vm->jniGlobalReferences, obj)) {
 #ifdef J9VM_THR_PREEMPTIVE
-		omrthread_monitor_exit(vm->jniFrameMutex);
+		omrthread_monitor_exit(vm->jniGlobalReferencesMutex);
 #endif
 		rc = JNIGlobalRefType;
 		goto done;
@@ -2198,14 +2198,14 @@ getObjectRefType(JNIEnv *env, jobject obj)
 
 	if (pool_includesElement(vm->jniWeakGlobalReferences, obj)) {
 #ifdef J9VM_THR_PREEMPTIVE
-		omrthread_monitor_exit(vm->jniFrameMutex);
+		omrthread_monitor_exit(vm->jniGlobalReferencesMutex);
 #endif
 		rc = JNIWeakGlobalRefType;
 		goto done;
 	}
 
 #ifdef J9VM_THR_PREEMPTIVE
-	omrthread_monitor_exit(vm->jniFrameMutex);
+	omrthread_monitor_exit(vm->jniGlobalReferencesMutex);
 #endif
 
 	/* Check for stack-based local refs */
@@ -2432,7 +2432,7 @@ defineClass(JNIEnv *env, const char *name, jobject loader, const jbyte *buf, jsi
 				 * entryIndex only applies to the system classloader, but since the classTableMutex is acquired,
 				 * there is no threading problem.
 				 */
-				J9TranslationLocalBuffer localBuffer = {J9_CP_INDEX_NONE, LOAD_LOCATION_UNKNOWN, NULL};
+				J9TranslationLocalBuffer localBuffer = {J9_CP_INDEX_NONE, LOAD_LOCATION_UNKNOWN, NULL, NULL};
 				/* this function exits the class table mutex */
 				clazz = dynamicLoadBuffers->internalDefineClassFunction(currentThread, className, classNameLength,
 						(U_8 *) buf, (UDATA) bufLen, NULL, classLoader, NULL, J9_FINDCLASS_FLAG_THROW_ON_FAIL, NULL, NULL, &localBuffer);
@@ -703,6 +703,11 @@ freeJavaVM(J9JavaVM * vm)
 		vm->modulesPathEntry = NULL;
 	}
 
+	if (NULL != vm->stackMapCache) {
+		j9mem_free_memory(vm->stackMapCache);
+		vm->stackMapCache = NULL;
+	}
+
 	if (NULL != vm->unamedModuleForSystemLoader) {
 		vm->internalVMFunctions->freeJ9Module(vm, vm->unamedModuleForSystemLoader);
 		vm->unamedModuleForSystemLoader = NULL;
@@ -5548,6 +5553,14 @@ protectedInitializeJavaVM(J9PortLibrary* portLibrary, void * userData)
 		goto error;
 	}
 
+	/* Enable -XX:+FastClassHashTable before any class loader exists so that every class hash table is
+	 * published rather than grown in place, and lookups never need the classTableMutex.  Startup is
+	 * when class loading is most concurrent, so do not wait for the end of startup to switch over.
+	 */
+	if (J9_ARE_NO_BITS_SET(vm->extendedRuntimeFlags, J9_EXTENDED_RUNTIME_DISABLE_FAST_CLASS_HASH_TABLE)) {
+		vm->extendedRuntimeFlags |= J9_EXTENDED_RUNTIME_FAST_CLASS_HASH_TABLE;
+	}
+
 #if !defined(WIN32)
 	if (J9_ARE_ANY_BITS_SET(vm->extendedRuntimeFlags,J9_EXTENDED_RUNTIME_HANDLE_SIGXFSZ)) {
 		j9sig_set_async_signal_handler(sigxfszHandler, NULL, J9PORT_SIG_FLAG_SIGXFSZ);
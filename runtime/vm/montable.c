@@ -50,10 +50,14 @@ static UDATA hits, misses;
 #define J9_OBJECT_MONITOR_LOOKUP_SLOT(object,vm) ( (((UDATA)object) >> vm->omrVM->_objectAlignmentShift) & (J9VMTHREAD_OBJECT_MONITOR_CACHE_SIZE-1))
 #endif
 
+#define J9_MONITOR_TABLE_LOOKUP_CACHE_SLOT(hash,probe) ( ((hash) + (probe)) & (J9VM_MONITOR_TABLE_LOOKUP_CACHE_SIZE-1))
+
 static UDATA hashMonitorCompare (void *leftKey, void *rightKey, void *userData);
 static UDATA hashMonitorDestroyDo (void *entry, void *opaque);
 static UDATA hashMonitorHash (void *key, void *userData);
 static J9HashTable* createMonitorTable(J9JavaVM *vm, char *tableName);
+static J9ObjectMonitor* peekMonitorTableLookupCache(J9VMThread *vmStruct, j9object_t object, U_32 hash);
+static void addToMonitorTableLookupCache(J9JavaVM *vm, J9ObjectMonitor *objectMonitor, U_32 hash);
 
 
 static UDATA
@@ -98,6 +102,78 @@ cacheObjectMonitorForLookup(J9JavaVM* vm, J9VMThread* vmStruct, J9ObjectMonitor*
 #endif
 
 
+/**
+ * Search the VM-wide monitor lookup cache for the monitor of an object.
+ * The cache is read without holding the monitor table mutex. Entries are only removed
+ * by the GC (see MM_RootScanner::scanMonitorLookupCaches), which cannot run while the
+ * caller holds VM access, so any monitor found here is still valid.
+ *
+ * @pre The caller must have VM access.
+ *
+ * @param vmStruct	the current thread
+ * @param object	the object whose monitor is wanted
+ * @param hash		the object's hash code
+ *
+ * @return the J9ObjectMonitor for object, or NULL if it is not in the cache
+ */
+static J9ObjectMonitor*
+peekMonitorTableLookupCache(J9VMThread *vmStruct, j9object_t object, U_32 hash)
+{
+	j9objectmonitor_t volatile *cache = vmStruct->javaVM->monitorTableLookupCache;
+	UDATA probe = 0;
+
+	for (probe = 0; probe < J9VM_MONITOR_TABLE_LOOKUP_CACHE_PROBES; probe++) {
+		J9ObjectMonitor *objectMonitor = (J9ObjectMonitor*) ((UDATA) cache[J9_MONITOR_TABLE_LOOKUP_CACHE_SLOT(hash, probe)]);
+		if (NULL == objectMonitor) {
+			/* slots are filled in probe order and only ever cleared all at once */
+			break;
+		}
+		/* the barrier gives the up-to-date location of the monitor's object under a concurrent GC, see hashMonitorCompare() */
+		if (J9MONITORTABLE_OBJECT_LOAD(vmStruct, &((J9ThreadAbstractMonitor*)objectMonitor->monitor)->userData) == object) {
+			return objectMonitor;
+		}
+	}
+	return NULL;
+}
+
+/**
+ * Publish a monitor from the monitor table in the VM-wide lookup cache.
+ * Empty slots are claimed with a compare and swap so concurrent inserts never lose a monitor
+ * that is already cached. If every probed slot is taken, the first one is replaced.
+ *
+ * @pre The caller must have VM access.
+ *
+ * @param vm			the vm
+ * @param objectMonitor	a monitor present in the monitor table
+ * @param hash			the hash code of the monitor's object
+ */
+static void
+addToMonitorTableLookupCache(J9JavaVM *vm, J9ObjectMonitor *objectMonitor, U_32 hash)
+{
+	j9objectmonitor_t volatile *cache = vm->monitorTableLookupCache;
+	j9objectmonitor_t entry = (j9objectmonitor_t) ((UDATA) objectMonitor);
+	UDATA probe = 0;
+
+	for (probe = 0; probe < J9VM_MONITOR_TABLE_LOOKUP_CACHE_PROBES; probe++) {
+		j9objectmonitor_t volatile *slot = &cache[J9_MONITOR_TABLE_LOOKUP_CACHE_SLOT(hash, probe)];
+		j9objectmonitor_t oldEntry = *slot;
+		if (0 == oldEntry) {
+#if defined(J9VM_INTERP_SMALL_MONITOR_SLOT)
+			oldEntry = (j9objectmonitor_t) compareAndSwapU32((U_32*)slot, 0, entry);
+#else
+			oldEntry = (j9objectmonitor_t) compareAndSwapUDATA((UDATA*)slot, 0, entry);
+#endif
+			if (0 == oldEntry) {
+				return;
+			}
+		}
+		if (entry == oldEntry) {
+			return;
+		}
+	}
+	cache[J9_MONITOR_TABLE_LOOKUP_CACHE_SLOT(hash, 0)] = entry;
+}
+
 
 /**
  * Creates the monitor hashtable
@@ -152,6 +228,12 @@ initializeMonitorTable(J9JavaVM* vm)
 		return -1;
 	}
 	memset(vm->monitorTables, 0, sizeof(J9HashTable *) * tableCount);
+
+	vm->monitorTableLookupCache = (j9objectmonitor_t *)j9mem_allocate_memory(sizeof(j9objectmonitor_t) * J9VM_MONITOR_TABLE_LOOKUP_CACHE_SIZE, OMRMEM_CATEGORY_VM);
+	if (NULL == vm->monitorTableLookupCache) {
+		return -1;
+	}
+	memset(vm->monitorTableLookupCache, 0, sizeof(j9objectmonitor_t) * J9VM_MONITOR_TABLE_LOOKUP_CACHE_SIZE);
 	
 	vm->monitorTableList = NULL;
 
@@ -202,6 +284,11 @@ destroyMonitorTable(J9JavaVM* vm)
 		vm->monitorTables = NULL;
 	}
 
+	if (NULL != vm->monitorTableLookupCache) {
+		PORT_ACCESS_FROM_JAVAVM(vm);
+		j9mem_free_memory(vm->monitorTableLookupCache);
+		vm->monitorTableLookupCache = NULL;
+	}
 
 	/* free the monitorTableListPool */
 	if (NULL != vm->monitorTableListPool) {
@@ -279,6 +366,20 @@ monitorTableAt(J9VMThread* vmStruct, j9object_t object)
 	key_monitor.userData = (UDATA) object;
 	key_objectMonitor.monitor = (omrthread_monitor_t) &key_monitor;
 	key_objectMonitor.hash = objectHashCode(vm, object);
+
+	/* Most lookups are for monitors which already exist - try to find them without taking the mutex */
+	objectMonitor = peekMonitorTableLookupCache(vmStruct, object, key_objectMonitor.hash);
+	if (NULL != objectMonitor) {
+		TRACE("Lookup cache hit");
+#ifdef J9VM_THR_LOCK_NURSERY
+		cacheObjectMonitorForLookup(vm, vmStruct, objectMonitor);
+#else
+		vmStruct->cachedMonitor = objectMonitor;
+#endif
+		Trc_VM_monitorTableAt_CacheHit_Exit(vmStruct, objectMonitor);
+		return objectMonitor;
+	}
+
 	index = key_objectMonitor.hash % (U_32)vm->monitorTableCount;
 	monitorTable = vm->monitorTables[index];
 
@@ -328,6 +429,8 @@ monitorTableAt(J9VMThread* vmStruct, j9object_t object)
 #endif /* J9VM_INTERP_CUSTOM_SPIN_OPTIONS */
 
 				key_objectMonitor.monitor = monitor;
+				/* assume spinning pays off until this monitor's history says otherwise */
+				key_objectMonitor.spinSuccessRate = J9_OBJECT_MONITOR_SPIN_RATE_ONE;
 
 #ifdef J9VM_THR_SMART_DEFLATION
 				key_objectMonitor.proDeflationCount = 0;
@@ -358,6 +461,10 @@ monitorTableAt(J9VMThread* vmStruct, j9object_t object)
 
 	omrthread_monitor_exit(mutex);
 
+	if (NULL != objectMonitor) {
+		addToMonitorTableLookupCache(vm, objectMonitor, key_objectMonitor.hash);
+	}
+
 	Trc_VM_monitorTableAt_Exit(vmStruct, objectMonitor);
 
 	return objectMonitor;
@@ -119,6 +119,11 @@ void freeMemorySegment(J9JavaVM *javaVM, J9MemorySegment *segment, BOOLEAN freeD
 
 	segmentList->totalSegmentSize -= segment->size;
 
+	if (J9_ARE_ANY_BITS_SET(segment->type, MEMORY_TYPE_ROM_CLASS)) {
+		/* invalidates the per thread stack trace frame caches and the stack map cache, which are keyed by ROM class addresses */
+		javaVM->romClassSegmentFreeCount += 1;
+	}
+
 	if (segment->type & MEMORY_TYPE_ALLOCATED) {
 		BOOLEAN useAdvise = (J9_EXTENDED_RUNTIME_FLAG_JSCRATCH_ADV_ON_FREE == (javaVM->extendedRuntimeFlags & J9_EXTENDED_RUNTIME_FLAG_JSCRATCH_ADV_ON_FREE));
 
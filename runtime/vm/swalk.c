@@ -92,6 +92,8 @@ static void getLocalsMap (J9StackWalkState * walkState, J9ROMClass * romClass, J
 #if (!defined(J9VM_OUT_OF_PROCESS)) 
 static UDATA allocateCache (J9StackWalkState * walkState);
 static void dropToCurrentFrame (J9StackWalkState * walkState);
+static BOOLEAN findCachedMap (J9StackWalkState * walkState, J9ROMMethod * romMethod, UDATA offsetPC, UDATA pushCount, U_32 * result);
+static void cacheMap (J9StackWalkState * walkState, J9ROMMethod * romMethod, UDATA offsetPC, UDATA pushCount, U_32 bits);
 #endif /* J9VM_!OUT_OF_PROCESS */
 
 /* The minimum number of stack slots that a stack frame can occupy */
@@ -1512,6 +1514,16 @@ getLocalsMap(J9StackWalkState * walkState, J9ROMClass * romClass, J9ROMMethod *
 		}
 	}
 
+#ifndef J9VM_OUT_OF_PROCESS
+	/* Only maps which fit in a single word are cached */
+	if ((argTempCount <= 32) && findCachedMap(walkState, romMethod, offsetPC, 0, result)) {
+#ifdef J9VM_INTERP_STACKWALK_TRACING
+		swPrintf(walkState, 4, "\tUsing cached local map\n");
+#endif
+		return;
+	}
+#endif
+
 #ifdef J9VM_INTERP_STACKWALK_TRACING
 	swPrintf(walkState, 4, "\tUsing local mapper\n");
 #endif
@@ -1530,6 +1542,11 @@ getLocalsMap(J9StackWalkState * walkState, J9ROMClass * romClass, J9ROMMethod *
 #endif
 #endif
 	}
+#ifndef J9VM_OUT_OF_PROCESS
+	else if (argTempCount <= 32) {
+		cacheMap(walkState, romMethod, offsetPC, 0, result[0]);
+	}
+#endif
 
 	return;
 }
@@ -1541,6 +1558,16 @@ getStackMap(J9StackWalkState * walkState, J9ROMClass * romClass, J9ROMMethod * r
 	PORT_ACCESS_FROM_WALKSTATE(walkState);
 	IDATA errorCode;
 
+#ifndef J9VM_OUT_OF_PROCESS
+	/* Only maps which fit in a single word are cached */
+	if ((pushCount <= 32) && findCachedMap(walkState, romMethod, offsetPC, pushCount, result)) {
+#ifdef J9VM_INTERP_STACKWALK_TRACING
+		swPrintf(walkState, 4, "\tUsing cached stack map\n");
+#endif
+		return;
+	}
+#endif
+
 	errorCode = j9stackmap_StackBitsForPC(PORTLIB, offsetPC, romClass, romMethod, result, pushCount, walkState->walkThread->javaVM, j9mapmemory_GetBuffer, j9mapmemory_ReleaseBuffer);
 	if (errorCode < 0) {
 #ifdef J9VM_OUT_OF_PROCESS
@@ -1555,10 +1582,140 @@ getStackMap(J9StackWalkState * walkState, J9ROMClass * romClass, J9ROMMethod * r
 #endif
 #endif
 	}
+#ifndef J9VM_OUT_OF_PROCESS
+	else if (pushCount <= 32) {
+		cacheMap(walkState, romMethod, offsetPC, pushCount, result[0]);
+	}
+#endif
 	return;
 }
 
 
+#if (!defined(J9VM_OUT_OF_PROCESS))
+#define STACKMAP_CACHE_INDEX(romMethod, offsetPC, pushCount) \
+	(((((UDATA)(romMethod)) >> 3) ^ ((offsetPC) * 31) ^ ((pushCount) << 7)) & (J9_STACKMAP_CACHE_SIZE - 1))
+
+/**
+ * Look up the locals or pending stack map for an interpreted PC in the VM wide stack map cache.
+ *
+ * Computing a map runs a dataflow pass over the method's bytecodes, and every GC scans the same
+ * frames again, so maps of small methods are remembered across walks.  The cache is direct mapped
+ * and shared by all walking threads without locking: each entry carries a sequence number which is
+ * odd while the entry is being written, and a reader only uses the entry if the sequence number
+ * was even and unchanged around its reads.  Entries written before a ROM class segment was freed
+ * are ignored, as their ROM method may since have been unloaded and its memory reused.  Entries
+ * written before vm->localMapFunction changed are ignored too: installDebugLocalMapper() runs when
+ * an agent adds can_access_local_variables, and the debug mapper keeps more locals alive.  Redefined
+ * classes get new ROM methods, so their entries are never looked up again and are overwritten.
+ *
+ * @param walkState The current stack walk state.
+ * @param romMethod The ROM method of the frame.
+ * @param offsetPC The bytecode index of the frame.
+ * @param pushCount 0 for the locals map, otherwise the pending stack height.
+ * @param result Receives the map on a hit.
+ * @return TRUE if the map was found.
+ */
+static BOOLEAN
+findCachedMap(J9StackWalkState * walkState, J9ROMMethod * romMethod, UDATA offsetPC, UDATA pushCount, U_32 * result)
+{
+	J9JavaVM *vm = walkState->walkThread->javaVM;
+	J9StackMapCache *cache = vm->stackMapCache;
+	BOOLEAN found = FALSE;
+
+	if (NULL != cache) {
+		J9StackMapCacheEntry *entry = &cache->entries[STACKMAP_CACHE_INDEX(romMethod, offsetPC, pushCount)];
+		UDATA sequence = entry->sequence;
+
+		if (0 == (sequence & 1)) {
+			J9ROMMethod *cachedROMMethod = NULL;
+			UDATA cachedOffsetPC = 0;
+			UDATA cachedPushCount = 0;
+			UDATA cachedFreeCount = 0;
+			void *cachedLocalMapFunction = NULL;
+			U_32 cachedBits = 0;
+
+			issueReadBarrier();
+			cachedROMMethod = entry->romMethod;
+			cachedOffsetPC = entry->offsetPC;
+			cachedPushCount = entry->pushCount;
+			cachedFreeCount = entry->romClassSegmentFreeCount;
+			cachedLocalMapFunction = entry->localMapFunction;
+			cachedBits = entry->bits;
+			issueReadBarrier();
+
+			if ((sequence == entry->sequence)
+				&& (romMethod == cachedROMMethod)
+				&& (offsetPC == cachedOffsetPC)
+				&& (pushCount == cachedPushCount)
+				&& (vm->romClassSegmentFreeCount == cachedFreeCount)
+				&& ((void *)vm->localMapFunction == cachedLocalMapFunction)
+			) {
+				result[0] = cachedBits;
+				found = TRUE;
+			}
+		}
+	}
+
+	if (NULL != walkState->currentThread) {
+		if (found) {
+			walkState->currentThread->stackMapCacheHits += 1;
+		} else {
+			walkState->currentThread->stackMapCacheMisses += 1;
+		}
+	}
+	return found;
+}
+
+/**
+ * Remember a map computed for an interpreted PC in the VM wide stack map cache, replacing whatever
+ * was in its entry.  If another thread is writing the entry, the map is simply not cached.
+ *
+ * @param walkState The current stack walk state.
+ * @param romMethod The ROM method of the frame.
+ * @param offsetPC The bytecode index of the frame.
+ * @param pushCount 0 for the locals map, otherwise the pending stack height.
+ * @param bits The map.
+ */
+static void
+cacheMap(J9StackWalkState * walkState, J9ROMMethod * romMethod, UDATA offsetPC, UDATA pushCount, U_32 bits)
+{
+	J9JavaVM *vm = walkState->walkThread->javaVM;
+	J9StackMapCache *cache = vm->stackMapCache;
+	J9StackMapCacheEntry *entry = NULL;
+	UDATA sequence = 0;
+
+	if (NULL == cache) {
+		PORT_ACCESS_FROM_JAVAVM(vm);
+		J9StackMapCache *newCache = j9mem_allocate_memory(sizeof(J9StackMapCache), OMRMEM_CATEGORY_VM);
+		if (NULL == newCache) {
+			return;
+		}
+		memset(newCache, 0, sizeof(J9StackMapCache));
+		cache = (J9StackMapCache *)compareAndSwapUDATA((UDATA *)&vm->stackMapCache, (UDATA)NULL, (UDATA)newCache);
+		if (NULL == cache) {
+			cache = newCache;
+		} else {
+			/* another thread installed its cache first */
+			j9mem_free_memory(newCache);
+		}
+	}
+
+	entry = &cache->entries[STACKMAP_CACHE_INDEX(romMethod, offsetPC, pushCount)];
+	sequence = entry->sequence;
+	if ((0 == (sequence & 1)) && (sequence == compareAndSwapUDATA((UDATA *)&entry->sequence, sequence, sequence + 1))) {
+		entry->romMethod = romMethod;
+		entry->offsetPC = offsetPC;
+		entry->pushCount = pushCount;
+		entry->romClassSegmentFreeCount = vm->romClassSegmentFreeCount;
+		entry->localMapFunction = (void *)vm->localMapFunction;
+		entry->bits = bits;
+		issueWriteBarrier();
+		entry->sequence = sequence + 2;
+	}
+}
+#endif /* J9VM_!OUT_OF_PROCESS */
+
+
 static void walkJNIRefs(J9StackWalkState * walkState, UDATA * currentRef, UDATA refCount)
 {
 #ifdef J9VM_INTERP_STACKWALK_TRACING
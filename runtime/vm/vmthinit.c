@@ -59,6 +59,7 @@ UDATA initializeVMThreading(J9JavaVM *vm)
 		omrthread_monitor_init_with_name(&vm->classTableMutex, 0, "VM class table") ||
 		omrthread_monitor_init_with_name(&vm->segmentMutex, 0 ,"VM segment") ||
 		omrthread_monitor_init_with_name(&vm->jniFrameMutex, 0, "VM JNI frame") ||
+		omrthread_monitor_init_with_name(&vm->jniGlobalReferencesMutex, 0, "VM JNI global references") ||
 #endif
 
 #ifdef J9VM_GC_FINALIZATION
@@ -126,6 +127,7 @@ void terminateVMThreading(J9JavaVM *vm)
 	if (vm->classLoaderModuleAndLocationMutex) omrthread_monitor_destroy(vm->classLoaderModuleAndLocationMutex);
 	if (vm->classLoaderBlocksMutex) omrthread_monitor_destroy(vm->classLoaderBlocksMutex);
 	if (vm->jniFrameMutex) omrthread_monitor_destroy(vm->jniFrameMutex);
+	if (vm->jniGlobalReferencesMutex) omrthread_monitor_destroy(vm->jniGlobalReferencesMutex);
 #endif
 
 	if (vm->runtimeFlagsMutex) omrthread_monitor_destroy(vm->runtimeFlagsMutex);
@@ -45,7 +45,7 @@
  * The zip cache version number must be changed if the zip
  * cache format changes.
  */
-#define ZIP_CACHE_VERSION 1
+#define ZIP_CACHE_VERSION 2
 
 #define UDATA_TOP_BIT    (((UDATA)1)<<(sizeof(UDATA)*8-1))
 #define ISCLASS_BIT    UDATA_TOP_BIT
@@ -53,6 +53,10 @@
 #define OFFSET_MASK	(~ISCLASS_BIT)
 #define	IMPLICIT_ENTRY	(~ISCLASS_BIT)
 
+/* The file index is kept at most half full */
+#define FILE_INDEX_INITIAL_SIZE	256
+#define FILE_INDEX_SIZE_IN_BYTES(size)	(sizeof(J9ZipFileIndex) + (((size) - 1) * sizeof(J9ZipFileIndexSlot)))
+
 
 void zipCache_freeChunk (J9PortLibrary * portLib, J9ZipChunkHeader *chunk);
 J9ZipDirEntry *zipCache_searchDirListCaseInsensitive (J9ZipDirEntry * dirEntry, const char *namePtr, UDATA nameSize, BOOLEAN isClass);
@@ -66,6 +70,14 @@ IDATA helper_memicmp (const void *src1, const void *src2, UDATA length);
 J9ZipDirEntry *zipCache_copyDirEntry(J9ZipCacheEntry *orgzce, J9ZipDirEntry *orgDirEntry, J9ZipCacheEntry *zce, J9ZipDirEntry *rootEntry);
 void zipCache_freeChunks(J9PortLibrary *portLib, J9ZipCacheEntry *zce);
 void zipCache_walkCache(J9PortLibrary * portLib, J9ZipCacheEntry *zce, J9ZipDirEntry *dirEntry);
+static UDATA zipCache_hashFileEntry(J9ZipCacheEntry *zce, J9ZipDirEntry *dirEntry, const char *namePtr, UDATA nameSize, BOOLEAN isClass);
+static void zipCache_insertIntoFileIndex(J9ZipCacheEntry *zce, J9ZipFileIndex *fileIndex, J9ZipDirEntry *dirEntry, J9ZipFileEntry *fileEntry);
+static void zipCache_addToFileIndex(J9PortLibrary *portLib, J9ZipCacheEntry *zce, J9ZipDirEntry *dirEntry, J9ZipFileEntry *fileEntry);
+static J9ZipFileEntry *zipCache_findFileEntry(J9ZipCacheEntry *zce, J9ZipDirEntry *dirEntry, const char *namePtr, UDATA nameSize, BOOLEAN isClass);
+static UDATA zipCache_fileIndexSizeFor(UDATA count);
+#if defined(J9VM_OPT_SHARED_CLASSES)
+static void zipCache_indexDirEntry(J9ZipCacheEntry *zce, J9ZipFileIndex *fileIndex, J9ZipDirEntry *dirEntry);
+#endif
 
 #define ZIP_SRP_SET(field, value) WSRP_PTR_SET(&field, value)
 #define ZIP_SRP_GET(field, type) WSRP_PTR_GET(&field, type)
@@ -99,6 +111,7 @@ J9ZipCache *zipCache_new(J9PortLibrary * portLib, char *zipName, IDATA zipNameLe
 	J9ZipChunkHeader *chunk;
 	J9ZipCacheInternal *zci;
 	J9ZipCacheEntry *zce;
+	J9ZipFileIndex *fileIndex;
 	char *zipFileName;
 
 	PORT_ACCESS_FROM_PORT(portLib);
@@ -144,6 +157,14 @@ J9ZipCache *zipCache_new(J9PortLibrary * portLib, char *zipName, IDATA zipNameLe
 	zce->zipFileSize = zipFileSize;
 	zce->zipTimeStamp = zipTimeStamp;
 	zce->root.zipFileOffset = 1;
+
+	/* Without a file index, lookups fall back to searching the file lists */
+	fileIndex = j9mem_allocate_memory(FILE_INDEX_SIZE_IN_BYTES(FILE_INDEX_INITIAL_SIZE), J9MEM_CATEGORY_VM_JCL);
+	if (NULL != fileIndex) {
+		memset(fileIndex, 0, FILE_INDEX_SIZE_IN_BYTES(FILE_INDEX_INITIAL_SIZE));
+		fileIndex->size = FILE_INDEX_INITIAL_SIZE;
+		ZIP_SRP_SET(zce->fileIndex, fileIndex);
+	}
 	
 	return (J9ZipCache *)zci;
 }
@@ -236,6 +257,11 @@ UDATA zipCache_cacheSize(J9ZipCache * zipCache) {
 		/* If the zip cache has already been copied, the currentChunk will be NULL and
 		 * the sizeRequired will be zero. */
 		U_8 *zipFileName = ZIP_SRP_GET(zce->zipFileName, U_8 *);
+		J9ZipFileIndex *fileIndex = J9ZIPCACHEENTRY_FILEINDEX(zce);
+		if (NULL != fileIndex) {
+			/* the copy gets a file index sized for the entries it holds */
+			sizeRequired += FILE_INDEX_SIZE_IN_BYTES(zipCache_fileIndexSizeFor(fileIndex->count));
+		}
 		/*If zipFileName is Null, then we should not add the length of zipFileName into sizerequired*/
 		if (NULL == zipFileName){
 			return sizeRequired;
@@ -357,6 +383,18 @@ BOOLEAN zipCache_copy(J9ZipCache * zipCache, void *cacheData, UDATA dataSize) {
 		return FALSE;
 	}
 
+	/* Build the file index in the copy, so JVMs using the copied cache do not have to */
+	if (NULL != J9ZIPCACHEENTRY_FILEINDEX(orgzce)) {
+		UDATA indexSize = zipCache_fileIndexSizeFor(J9ZIPCACHEENTRY_FILEINDEX(orgzce)->count);
+		char *unused = NULL;
+		J9ZipFileIndex *fileIndex = (J9ZipFileIndex *) zipCache_reserveEntry(zce, chunk, FILE_INDEX_SIZE_IN_BYTES(indexSize), 0, &unused);
+		if (NULL != fileIndex) {
+			fileIndex->size = indexSize;
+			zipCache_indexDirEntry(zce, fileIndex, &zce->root);
+			ZIP_SRP_SET(zce->fileIndex, fileIndex);
+		}
+	}
+
 	/* Null the currentChunk so it can't be free'd */
 	ZIP_SRP_SET_TO_NULL(zce->currentChunk);
 
@@ -605,13 +643,14 @@ zipCache_addElement(J9ZipCache * zipCache, char *elementName, IDATA elementNameL
 			/* The prefix we're looking at doesn't end with a '/', which means */
 			/* it is really the suffix of the elementName, and it's a filename. */
 
-			fileEntry = zipCache_searchFileList(dirEntry, curName, curSize, isClass);
+			fileEntry = zipCache_findFileEntry(zce, dirEntry, curName, curSize, isClass);
 			if(fileEntry) {
 				/* We've seen this file before...update the entry to the new offset. */
 				fileEntry->zipFileOffset = elementOffset | (isClass ? ISCLASS_BIT : 0);
 			} else {
-				if (!zipCache_addToFileList(portLib, zce, dirEntry, curName, curSize, isClass, elementOffset))
+				if (!(fileEntry = zipCache_addToFileList(portLib, zce, dirEntry, curName, curSize, isClass, elementOffset)))
 					return FALSE;
+				zipCache_addToFileIndex(portLib, zce, dirEntry, fileEntry);
 			}
 			return TRUE;
 		}
@@ -697,7 +736,7 @@ zipCache_findElement(J9ZipCache * zipCache, const char *elementName, IDATA eleme
 			/* The prefix we're looking at doesn't end with a '/', which means */
 			/* it is really the suffix of the elementName, and it's a filename. */
 
-			fileEntry = zipCache_searchFileList(dirEntry, curName, curSize, isClass);
+			fileEntry = zipCache_findFileEntry(zce, dirEntry, curName, curSize, isClass);
 			if (fileEntry) {
 				return fileEntry->zipFileOffset & OFFSET_MASK;
 			}
@@ -748,6 +787,11 @@ void zipCache_freeChunks(J9PortLibrary *portLib, J9ZipCacheEntry *zce)
 		j9mem_free_memory(zipFileName);
 	}
 
+	if (NULL != J9ZIPCACHEENTRY_FILEINDEX(zce)) {
+		j9mem_free_memory(J9ZIPCACHEENTRY_FILEINDEX(zce));
+		ZIP_SRP_SET_TO_NULL(zce->fileIndex);
+	}
+
 	while (chunk) {
 		chunk2 = ZIP_SRP_GET(chunk->next, J9ZipChunkHeader *);
 		zipCache_freeChunk(portLib, chunk);
@@ -996,6 +1040,163 @@ J9ZipFileEntry *zipCache_searchFileList(J9ZipDirEntry * dirEntry, const char *na
 
 
 
+/* Hashes a file entry name within a directory. The directory is identified by its */
+/* offset from the cache entry, so the hash only depends on the layout of one cache. */
+
+static UDATA
+zipCache_hashFileEntry(J9ZipCacheEntry *zce, J9ZipDirEntry *dirEntry, const char *namePtr, UDATA nameSize, BOOLEAN isClass)
+{
+	UDATA hash = ((UDATA)dirEntry - (UDATA)zce) | (isClass ? 1 : 0);
+	UDATA i;
+
+	for (i = 0; i < nameSize; i++) {
+		hash = (hash * 31) + (U_8)namePtr[i];
+	}
+	return hash ^ (hash >> 16);
+}
+
+
+
+/* Returns the number of slots in a file index which holds count entries. */
+
+static UDATA
+zipCache_fileIndexSizeFor(UDATA count)
+{
+	UDATA size = FILE_INDEX_INITIAL_SIZE;
+
+	while (size < (count * 2)) {
+		size *= 2;
+	}
+	return size;
+}
+
+
+
+/* Inserts fileEntry into a file index which has room for it. */
+
+static void
+zipCache_insertIntoFileIndex(J9ZipCacheEntry *zce, J9ZipFileIndex *fileIndex, J9ZipDirEntry *dirEntry, J9ZipFileEntry *fileEntry)
+{
+	UDATA mask = fileIndex->size - 1;
+	UDATA slotIndex = zipCache_hashFileEntry(zce, dirEntry, J9ZIPFILEENTRY_NAME(fileEntry), fileEntry->nameLength,
+			(fileEntry->zipFileOffset & ISCLASS_BIT) != 0) & mask;
+
+	while (0 != fileIndex->slots[slotIndex].fileEntry) {
+		slotIndex = (slotIndex + 1) & mask;
+	}
+	ZIP_SRP_SET(fileIndex->slots[slotIndex].dirEntry, dirEntry);
+	ZIP_SRP_SET(fileIndex->slots[slotIndex].fileEntry, fileEntry);
+	fileIndex->count++;
+}
+
+
+
+/* Adds a new file entry to the file index of a cache which is being built, growing the */
+/* index as required. If memory runs out the index is discarded and lookups fall back */
+/* to searching the file lists. */
+
+static void
+zipCache_addToFileIndex(J9PortLibrary *portLib, J9ZipCacheEntry *zce, J9ZipDirEntry *dirEntry, J9ZipFileEntry *fileEntry)
+{
+	J9ZipFileIndex *fileIndex = ZIP_SRP_GET(zce->fileIndex, J9ZipFileIndex *);
+	PORT_ACCESS_FROM_PORT(portLib);
+
+	if (NULL == fileIndex) {
+		/* the cache was created without an index, or it has been discarded */
+		return;
+	}
+
+	if (((fileIndex->count + 1) * 2) > fileIndex->size) {
+		UDATA newSize = fileIndex->size * 2;
+		J9ZipFileIndex *newIndex = j9mem_allocate_memory(FILE_INDEX_SIZE_IN_BYTES(newSize), J9MEM_CATEGORY_VM_JCL);
+		UDATA i;
+
+		if (NULL == newIndex) {
+			j9mem_free_memory(fileIndex);
+			ZIP_SRP_SET_TO_NULL(zce->fileIndex);
+			return;
+		}
+		memset(newIndex, 0, FILE_INDEX_SIZE_IN_BYTES(newSize));
+		newIndex->size = newSize;
+		for (i = 0; i < fileIndex->size; i++) {
+			J9ZipFileIndexSlot *slot = &fileIndex->slots[i];
+			if (0 != slot->fileEntry) {
+				zipCache_insertIntoFileIndex(zce, newIndex, J9ZIPFILEINDEXSLOT_DIRENTRY(slot), J9ZIPFILEINDEXSLOT_FILEENTRY(slot));
+			}
+		}
+		j9mem_free_memory(fileIndex);
+		fileIndex = newIndex;
+		ZIP_SRP_SET(zce->fileIndex, fileIndex);
+	}
+	zipCache_insertIntoFileIndex(zce, fileIndex, dirEntry, fileEntry);
+}
+
+
+
+/* Finds the file entry named namePtr[0..nameSize-1] with the specified isClass value */
+/* in dirEntry, using the file index when the cache has one. */
+
+static J9ZipFileEntry *
+zipCache_findFileEntry(J9ZipCacheEntry *zce, J9ZipDirEntry *dirEntry, const char *namePtr, UDATA nameSize, BOOLEAN isClass)
+{
+	J9ZipFileIndex *fileIndex = ZIP_SRP_GET(zce->fileIndex, J9ZipFileIndex *);
+	UDATA mask;
+	UDATA slotIndex;
+
+	if (NULL == fileIndex) {
+		return zipCache_searchFileList(dirEntry, namePtr, nameSize, isClass);
+	}
+	if (!dirEntry || !namePtr) {
+		return NULL;
+	}
+
+	mask = fileIndex->size - 1;
+	slotIndex = zipCache_hashFileEntry(zce, dirEntry, namePtr, nameSize, isClass) & mask;
+	while (0 != fileIndex->slots[slotIndex].fileEntry) {
+		J9ZipFileIndexSlot *slot = &fileIndex->slots[slotIndex];
+		J9ZipFileEntry *entry = J9ZIPFILEINDEXSLOT_FILEENTRY(slot);
+
+		if ((J9ZIPFILEINDEXSLOT_DIRENTRY(slot) == dirEntry)
+			&& (entry->nameLength == nameSize)
+			&& (isClass == ((entry->zipFileOffset & ISCLASS_BIT) != 0))
+			&& !memcmp(J9ZIPFILEENTRY_NAME(entry), namePtr, nameSize)
+		) {
+			return entry;
+		}
+		slotIndex = (slotIndex + 1) & mask;
+	}
+	return NULL;
+}
+
+
+
+#if defined(J9VM_OPT_SHARED_CLASSES)
+/* Adds every file in dirEntry and its subdirectories to fileIndex. */
+
+static void
+zipCache_indexDirEntry(J9ZipCacheEntry *zce, J9ZipFileIndex *fileIndex, J9ZipDirEntry *dirEntry)
+{
+	while (dirEntry) {
+		J9ZipFileRecord *record = ZIP_SRP_GET(dirEntry->fileList, J9ZipFileRecord *);
+		while (record) {
+			J9ZipFileEntry *fileEntry = record->entry;
+			UDATA i;
+			for (i = 0; i < record->entryCount; i++) {
+				zipCache_insertIntoFileIndex(zce, fileIndex, dirEntry, fileEntry);
+				fileEntry = J9ZIPFILEENTRY_NEXT(fileEntry);
+			}
+			record = ZIP_SRP_GET(record->next, J9ZipFileRecord *);
+		}
+		if (dirEntry->dirList) {
+			zipCache_indexDirEntry(zce, fileIndex, ZIP_SRP_GET(dirEntry->dirList, J9ZipDirEntry *));
+		}
+		dirEntry = ZIP_SRP_GET(dirEntry->next, J9ZipDirEntry *);
+	}
+}
+#endif
+
+
+
 /** 
  * Searches for a directory named elementName in zipCache and if found provides 
  * a handle to it that can be used to enumerate through all of the directory's files.
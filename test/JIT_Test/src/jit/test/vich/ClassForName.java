@@ -0,0 +1,95 @@
+/*******************************************************************************
+ * Copyright (c) 2017, 2017 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+package jit.test.vich;
+
+import org.testng.Assert;
+import org.testng.annotations.Test;
+import org.testng.log4testng.Logger;
+import jit.test.vich.utils.Timer;
+
+/**
+ * Looks up already loaded classes by name from many threads at once.
+ */
+public class ClassForName {
+
+	private static Logger logger = Logger.getLogger(ClassForName.class);
+	Timer timer;
+
+	public ClassForName() {
+		timer = new Timer ();
+	}
+
+	static final int loopCount = 20000;
+	static final int threadCount = 64;
+	static final String[] classNames = {
+		"java.lang.Object",
+		"java.lang.String",
+		"java.lang.Thread",
+		"java.util.HashMap",
+		"java.util.ArrayList",
+		"jit.test.vich.ClassForName",
+		"jit.test.vich.utils.Timer",
+		"org.testng.Assert",
+	};
+
+	void lookupClasses(int loopCount) {
+		ClassLoader loader = ClassForName.class.getClassLoader();
+		try {
+			for (int i = 0; i < loopCount; i++) {
+				for (int j = 0; j < classNames.length; j++) {
+					Class.forName(classNames[j], false, loader);
+				}
+			}
+		} catch (ClassNotFoundException e) {
+			Assert.fail("Class lookup failed: " + e);
+		}
+	}
+
+	@Test(groups = { "level.sanity","component.jit" })
+	public void testClassForName() throws InterruptedException
+	{
+		lookupClasses(1);
+
+		timer.reset();
+		lookupClasses(loopCount);
+		timer.mark();
+		logger.info(loopCount + " Class.forName calls (on " + classNames.length + " classes) in 1 thread = " + timer.delta());
+
+		Thread[] threads = new Thread[threadCount];
+		for (int i = 0; i < threadCount; i++) {
+			threads[i] = new Thread() {
+				public void run() {
+					lookupClasses(loopCount);
+				}
+			};
+		}
+		timer.reset();
+		for (int i = 0; i < threadCount; i++) {
+			threads[i].start();
+		}
+		for (int i = 0; i < threadCount; i++) {
+			threads[i].join();
+		}
+		timer.mark();
+		logger.info(loopCount + " Class.forName calls (on " + classNames.length + " classes) in each of " + threadCount + " threads = " + timer.delta());
+	}
+}
@@ -0,0 +1,87 @@
+/*******************************************************************************
+ * Copyright (c) 2017, 2017 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+package jit.test.vich;
+
+import org.testng.Assert;
+import org.testng.annotations.Test;
+import org.testng.log4testng.Logger;
+import jit.test.vich.utils.Timer;
+
+/**
+ * Creates and deletes JNI global and weak global references from many threads at once.
+ */
+public class JNIGlobalRef {
+
+	private static Logger logger = Logger.getLogger(JNIGlobalRef.class);
+	Timer timer;
+
+	static {
+		try {
+			System.loadLibrary("j9ben");
+		} catch (UnsatisfiedLinkError e) {}
+	}
+
+	public JNIGlobalRef() {
+		timer = new Timer ();
+	}
+
+	static final int loopCount = 10000;
+	static final int threadCount = 32;
+
+	public native void globalReferenceChurn(Object o1, int loopCount);
+
+	@Test(groups = { "level.sanity","component.jit" })
+	public void testJNIGlobalRef() throws InterruptedException
+	{
+		final Object o1 = new Integer(0);
+
+		try
+		{
+			globalReferenceChurn(o1, 1);
+		} catch (UnsatisfiedLinkError e) {
+			Assert.fail("No natives for JNI tests");
+		}
+
+		timer.reset();
+		globalReferenceChurn(o1, loopCount);
+		timer.mark();
+		logger.info(loopCount + " New/DeleteGlobalRef and New/DeleteWeakGlobalRef calls (on 8 objects) in 1 thread = " + timer.delta());
+
+		Thread[] threads = new Thread[threadCount];
+		for (int i = 0; i < threadCount; i++) {
+			threads[i] = new Thread() {
+				public void run() {
+					globalReferenceChurn(o1, loopCount);
+				}
+			};
+		}
+		timer.reset();
+		for (int i = 0; i < threadCount; i++) {
+			threads[i].start();
+		}
+		for (int i = 0; i < threadCount; i++) {
+			threads[i].join();
+		}
+		timer.mark();
+		logger.info(loopCount + " New/DeleteGlobalRef and New/DeleteWeakGlobalRef calls (on 8 objects) in each of " + threadCount + " threads = " + timer.delta());
+	}
+}
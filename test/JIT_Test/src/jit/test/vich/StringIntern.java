@@ -0,0 +1,89 @@
+/*******************************************************************************
+ * Copyright (c) 2017, 2017 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+package jit.test.vich;
+
+import org.testng.Assert;
+import org.testng.annotations.Test;
+import org.testng.log4testng.Logger;
+import jit.test.vich.utils.Timer;
+
+/**
+ * Interns the same set of strings from 1 up to maxThreadCount threads at once, reporting the time taken at each thread count.
+ */
+public class StringIntern {
+
+	private static Logger logger = Logger.getLogger(StringIntern.class);
+	Timer timer;
+
+	public StringIntern() {
+		timer = new Timer ();
+	}
+
+	static final int loopCount = 200;
+	static final int stringCount = 1024;
+	static final int maxThreadCount = 64;
+
+	final String[] interned = new String[stringCount];
+	final String[] copies = new String[stringCount];
+
+	void internStrings(int loopCount) {
+		for (int i = 0; i < loopCount; i++) {
+			for (int j = 0; j < stringCount; j++) {
+				if (copies[j].intern() != interned[j]) {
+					Assert.fail("String.intern() returned a different String for " + interned[j]);
+				}
+			}
+		}
+	}
+
+	@Test(groups = { "level.sanity","component.jit" })
+	public void testStringIntern() throws InterruptedException
+	{
+		for (int i = 0; i < stringCount; i++) {
+			String value = "jit.test.vich.StringIntern." + i;
+			interned[i] = value.intern();
+			/* a distinct String with the same value, so every intern() call looks it up */
+			copies[i] = new String(value.toCharArray());
+		}
+		internStrings(1);
+
+		for (int threadCount = 1; threadCount <= maxThreadCount; threadCount *= 2) {
+			Thread[] threads = new Thread[threadCount];
+			for (int i = 0; i < threadCount; i++) {
+				threads[i] = new Thread() {
+					public void run() {
+						internStrings(loopCount);
+					}
+				};
+			}
+			timer.reset();
+			for (int i = 0; i < threadCount; i++) {
+				threads[i].start();
+			}
+			for (int i = 0; i < threadCount; i++) {
+				threads[i].join();
+			}
+			timer.mark();
+			logger.info(loopCount + " String.intern calls (on " + stringCount + " strings) in each of " + threadCount + " threads = " + timer.delta());
+		}
+	}
+}
@@ -59,4 +59,6 @@ public class Helpers {
 	
 	public static native void monitorReserve(Object obj);
 	
+	public static native int monitorTableContention(Object[] objects, int iterations);
+	
 }
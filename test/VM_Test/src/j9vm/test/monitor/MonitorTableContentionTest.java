@@ -0,0 +1,70 @@
+/*******************************************************************************
+ * Copyright (c) 2017, 2017 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+/*
+package j9vm.test.monitor;
+
+/**
+ * Enters and exits the monitors of a set of arrays from several threads at once.
+ * Arrays have no lockword, so every enter looks the monitor up in the VM's monitor table,
+ * which makes this a contention benchmark for monitor table lookups.
+ */
+public class MonitorTableContentionTest {
+
+	private static final int threadCount = 8;
+	private static final int objectCount = 48;
+	private static final int iterations = 20000;
+
+	public static void main(String[] args) throws InterruptedException {
+		final Object[] objects = new Object[objectCount];
+		for (int i = 0; i < objectCount; i++) {
+			objects[i] = new int[1];
+		}
+
+		Thread[] threads = new Thread[threadCount];
+		final int[] results = new int[threadCount];
+		for (int i = 0; i < threadCount; i++) {
+			final int index = i;
+			threads[i] = new Thread() {
+				public void run() {
+					results[index] = Helpers.monitorTableContention(objects, iterations);
+				}
+			};
+		}
+
+		long start = System.nanoTime();
+		for (int i = 0; i < threadCount; i++) {
+			threads[i].start();
+		}
+		for (int i = 0; i < threadCount; i++) {
+			threads[i].join();
+		}
+		long elapsed = System.nanoTime() - start;
+
+		for (int i = 0; i < threadCount; i++) {
+			if (0 != results[i]) {
+				throw new Error("monitorTableContention() failed in thread " + i + ". rc = " + results[i]);
+			}
+		}
+		System.out.println(threadCount + " threads x " + objectCount + " arrays x " + iterations
+				+ " monitor enter/exit took " + (elapsed / 1000000) + " ms");
+	}
+}
@@ -0,0 +1,54 @@
+/*******************************************************************************
+ * Copyright (c) 2017, 2017 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+package org.openj9.test.bcvshared;
+
+/**
+ * Loaded from the shared classes cache by several JVMs with different verification settings.
+ * It accesses no protected members and looks up no other classes during verification, so the
+ * first JVM attached to the cache with a given set of flags records its verification result.
+ */
+public class SharedVerifyTarget {
+
+	private static int sum(int[] values) {
+		int total = 0;
+		for (int i = 0; i < values.length; i++) {
+			if (0 == (values[i] & 1)) {
+				total += values[i];
+			} else {
+				total -= values[i];
+			}
+		}
+		return total;
+	}
+
+	public static void main(String[] args) {
+		int[] values = new int[16];
+		for (int i = 0; i < values.length; i++) {
+			values[i] = i * i;
+		}
+		if (-120 == sum(values)) {
+			System.out.println("Test PASSED");
+		} else {
+			System.out.println("Test FAILED");
+		}
+	}
+}
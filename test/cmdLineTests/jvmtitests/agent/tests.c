@@ -114,6 +114,7 @@ static jvmtiTest jvmtiTestList[] =
 	{ "sca001",    sca001,    "com.ibm.jvmti.tests.sharedCacheAPI.sca001",                    "SharedCacheAPI" },
 	{ "gmc001",    gmc001,    "com.ibm.jvmti.tests.getMemoryCategories.gmc001",               "GetMemoryCategories" },
 	{ "gosl001",   gosl001,   "com.ibm.jvmti.tests.getOrSetLocal.gosl001",                    "Get or Set local variables" },
+	{ "gosl002",   gosl002,   "com.ibm.jvmti.tests.getOrSetLocal.gosl002",                    "Get an object local after can_access_local_variables is added late" },
 	{ "vgc001",    vgc001,    "com.ibm.jvmti.tests.verboseGC.vgc001",                         "Register a verbose GC subscriber" },
 	{ "gjvmt001",  gjvmt001,  "com.ibm.jvmti.tests.getJ9vmThread.gjvmt001",                   "Fetch J9VMThread from a java.lang.thread instance" },
 	{ "gj9m001",   gj9m001,   "com.ibm.jvmti.tests.getJ9method.gj9m001",                      "Fetch J9Method from a mid" },
@@ -229,6 +229,7 @@ jint JNICALL jlm001(agentEnv * env, char * args);
 jint JNICALL sca001(agentEnv * env, char * args);
 jint JNICALL gmc001(agentEnv * env, char * args);
 jint JNICALL gosl001(agentEnv * env, char * args);
+jint JNICALL gosl002(agentEnv * env, char * args);
 jint JNICALL vgc001(agentEnv * env, char * args);
 jint JNICALL gjvmt001(agentEnv * agent_env, char * args);
 jint JNICALL gj9m001(agentEnv * agent_env, char * args);
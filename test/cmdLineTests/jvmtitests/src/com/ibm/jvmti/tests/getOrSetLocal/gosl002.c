@@ -0,0 +1,130 @@
+/*******************************************************************************
+ * Copyright (c) 2017, 2017 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+#include <string.h>
+
+#include "ibmjvmti.h"
+#include "jvmti_test.h"
+
+static agentEnv * env;
+
+jint JNICALL
+gosl002(agentEnv * agent_env, char * args)
+{
+	env = agent_env;
+
+	/* can_access_local_variables is only added once the test is running, so the VM starts with the non debug local mapper */
+	return JNI_OK;
+}
+
+jboolean JNICALL
+Java_com_ibm_jvmti_tests_getOrSetLocal_gosl002_addLocalAccess(JNIEnv *jni_env, jclass clazz)
+{
+	JVMTI_ACCESS_FROM_AGENT(env);
+	jvmtiCapabilities capabilities;
+	jvmtiError err;
+
+	memset(&capabilities, 0, sizeof(jvmtiCapabilities));
+	capabilities.can_access_local_variables = 1;
+	err = (*jvmti_env)->AddCapabilities(jvmti_env, &capabilities);
+	if (err != JVMTI_ERROR_NONE) {
+		error(env, err, "Failed to add capabilities");
+		return JNI_FALSE;
+	}
+
+	return JNI_TRUE;
+}
+
+/* Check that the named object local of the caller's frame still refers to expected */
+jboolean JNICALL
+Java_com_ibm_jvmti_tests_getOrSetLocal_gosl002_checkLocalObject(JNIEnv *jni_env, jclass clazz, jstring s_methodName, jstring s_methodSignature, jstring s_varName, jobject expected)
+{
+	JVMTI_ACCESS_FROM_AGENT(env);
+	jvmtiError err;
+	jvmtiLocalVariableEntry * table = NULL;
+	jint entryCount = 0;
+	jint slot = -1;
+	jobject value = NULL;
+	jmethodID method;
+	jboolean rc = JNI_FALSE;
+	jint i;
+	const char * methodName;
+	const char * methodSignature;
+	const char * varName;
+
+	methodName = (*jni_env)->GetStringUTFChars(jni_env, s_methodName, NULL);
+	methodSignature = (*jni_env)->GetStringUTFChars(jni_env, s_methodSignature, NULL);
+	varName = (*jni_env)->GetStringUTFChars(jni_env, s_varName, NULL);
+	if ((methodName == NULL) || (methodSignature == NULL) || (varName == NULL)) {
+		error(env, JVMTI_ERROR_OUT_OF_MEMORY, "Unable to allocate method or variable name");
+		goto done;
+	}
+
+	method = (*jni_env)->GetStaticMethodID(jni_env, clazz, methodName, methodSignature);
+	if (method == NULL) {
+		error(env, JVMTI_ERROR_INVALID_METHODID, "Unable to find method [%s][%s]", methodName, methodSignature);
+		goto done;
+	}
+
+	err = (*jvmti_env)->GetLocalVariableTable(jvmti_env, method, &entryCount, &table);
+	if (err != JVMTI_ERROR_NONE) {
+		error(env, err, "GetLocalVariableTable() failed");
+		goto done;
+	}
+	for (i = 0; i < entryCount; i++) {
+		if (strcmp(table[i].name, varName) == 0) {
+			slot = table[i].slot;
+		}
+		(*jvmti_env)->Deallocate(jvmti_env, (unsigned char *) table[i].name);
+		(*jvmti_env)->Deallocate(jvmti_env, (unsigned char *) table[i].signature);
+		(*jvmti_env)->Deallocate(jvmti_env, (unsigned char *) table[i].generic_signature);
+	}
+	(*jvmti_env)->Deallocate(jvmti_env, (unsigned char *) table);
+	if (slot == -1) {
+		error(env, JVMTI_ERROR_INVALID_SLOT, "No local named [%s] in [%s][%s]", varName, methodName, methodSignature);
+		goto done;
+	}
+
+	/* depth 0 is this native, the frame holding the local is its caller */
+	err = (*jvmti_env)->GetLocalObject(jvmti_env, NULL, 1, slot, &value);
+	if (err != JVMTI_ERROR_NONE) {
+		error(env, err, "GetLocalObject() failed");
+		goto done;
+	}
+
+	if ((*jni_env)->IsSameObject(jni_env, value, expected) != JNI_TRUE) {
+		error(env, JVMTI_ERROR_NONE, "Local [%s] no longer refers to the object stored in it, GC did not update it", varName);
+		goto done;
+	}
+	rc = JNI_TRUE;
+
+done:
+	if (methodName != NULL) {
+		(*jni_env)->ReleaseStringUTFChars(jni_env, s_methodName, methodName);
+	}
+	if (methodSignature != NULL) {
+		(*jni_env)->ReleaseStringUTFChars(jni_env, s_methodSignature, methodSignature);
+	}
+	if (varName != NULL) {
+		(*jni_env)->ReleaseStringUTFChars(jni_env, s_varName, varName);
+	}
+	return rc;
+}
@@ -0,0 +1,74 @@
+/*******************************************************************************
+ * Copyright (c) 2017, 2017 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+package com.ibm.jvmti.tests.getOrSetLocal;
+
+/**
+ * GC remembers the local maps of interpreted frames between stack walks. Adding can_access_local_variables
+ * once the VM is running switches to the debug local mapper, which keeps in scope locals alive, so maps
+ * remembered before the switch must not be used after it. Run with -Xint so the frame stays interpreted.
+ */
+public class gosl002
+{
+	static Object expected;
+	static Object[] garbage;
+
+	native static boolean addLocalAccess();
+	native static boolean checkLocalObject(String methodName, String methodSignature, String varName, Object expected);
+
+	public boolean testLocalMapAfterLateCapability()
+	{
+		return holdLocal();
+	}
+
+	public String helpLocalMapAfterLateCapability()
+	{
+		return "an object local which is dead to the default local mapper is updated by GC once can_access_local_variables is added";
+	}
+
+	private static boolean holdLocal()
+	{
+		Object localObject = new Object();
+
+		/* localObject is not read again, so only the debug local mapper reports it */
+		expected = localObject;
+		for (int i = 0; i < 4; i++) {
+			if (2 == i) {
+				if (!addLocalAccess()) {
+					return false;
+				}
+			}
+			/* the frame is walked at the same bytecode index before and after the mapper changes */
+			collect();
+		}
+		return checkLocalObject("holdLocal", "()Z", "localObject", expected);
+	}
+
+	private static void collect()
+	{
+		/* fill the nursery so the scavenger moves localObject, as well as asking for a global collection */
+		for (int i = 0; i < 64; i++) {
+			garbage = new Object[64 * 1024];
+		}
+		garbage = null;
+		System.gc();
+	}
+}